@@ -23,6 +23,7 @@ using std::endl;
 using std::string;
 using std::ostream;
 using std::ios;
+using namespace custom;
 //using std::setw;
 //using namespace std;
 
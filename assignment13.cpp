@@ -28,8 +28,6 @@ using std::ifstream;
 using namespace custom;
 //using namespace std;
 
-int Vertex::max = 10;
-
 // prototypes for our four test functions
 void testSimple();
 void testAdd();
@@ -186,8 +184,6 @@ void testAdd()
 #endif // TEST2   
 }
 
-int CVertex::maxCol = 0;
-
 /*******************************************
  * TEST Query
  * Determine if two verticies are connected
@@ -208,8 +204,8 @@ void testQuery()
       g1.clear();
 
       // need some variables
-      CVertex vFrom;
-      CVertex vTo;
+      CVertex vFrom(g2.getDomain());
+      CVertex vTo(g2.getDomain());
    
       // allow the user to prompt for verticies  
       cout << "Determine if a given edge exists in the graph\n";
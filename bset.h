@@ -0,0 +1,795 @@
+/***********************************************************************
+* Header:
+*    BSET
+* Summary:
+*    This class contains the notion of a set: a bucket to hold
+*    data for the user that can change sizes dynamically.
+*    Of particular interest is how it is stored: a B+ tree whose nodes
+*    are a few cache lines long. All the elements are in the leaves,
+*    which are linked to each other in order, so inserting or erasing
+*    costs O(log n) and walking the set is a walk through arrays.
+*    Use it instead of set when a set grows to many thousands of items.
+*
+*    This will contain the class definition of:
+*       bset                : similar to std::set
+*       bset :: iterator    : an iterator through the bset
+* Author
+*    Daniel Perez, Benjamin Dyas
+************************************************************************/
+#ifndef BSET_H
+#define BSET_H
+
+#define BSET_NODE_BYTES 256   // four cache lines per node
+
+namespace custom
+{
+   /************************************************
+    * BSET
+    * Container class that holds unique values in
+    * a B+ tree
+    ***********************************************/
+   template <class T>
+   class bset
+   {
+   private:
+      // how many elements and children fit in a node
+      static const int LEAF_MAX  = (BSET_NODE_BYTES / sizeof(T) > 4 ?
+                                    BSET_NODE_BYTES / sizeof(T) : 4);
+      static const int INNER_MAX = (BSET_NODE_BYTES / (sizeof(T) + sizeof(void *)) > 4 ?
+                                    BSET_NODE_BYTES / (sizeof(T) + sizeof(void *)) : 4);
+
+      // every node but the root is kept at least half full
+      static const int LEAF_MIN  = LEAF_MAX  / 2;
+      static const int INNER_MIN = INNER_MAX / 2;
+
+      // the part both kinds of node have
+      struct Node
+      {
+         bool isLeaf;
+         int  numKeys;
+      };
+
+      // the leaves hold the elements. One spare slot lets a leaf
+      //    overflow for a moment before it is split
+      struct Leaf : public Node
+      {
+         T keys[LEAF_MAX + 1];
+         Leaf * pNext;
+         Leaf * pPrev;
+      };
+
+      // the inner nodes hold copies of the first key of every
+      //    child but the first one
+      struct Inner : public Node
+      {
+         T keys[INNER_MAX + 1];
+         Node * children[INNER_MAX + 2];
+      };
+
+   public:
+      // constructors & destructor
+      bset() : pRoot{ nullptr }, pFirst{ nullptr }, pLast{ nullptr },
+               numElements{ 0 } {}
+      bset(const bset & rhs);
+      ~bset() { clear(); }
+
+      // overloaded operators
+      bset & operator = (const bset & rhs);
+
+      // standard container interfaces
+      int   size()      const { return numElements; }
+      bool  empty()     const { return (numElements == 0); }
+      void  clear();
+
+      // the various iterator interfaces
+      class iterator;
+      iterator begin()      { return iterator(pFirst, 0); }
+      iterator end();
+
+      class const_iterator;
+      const_iterator cbegin() const { return const_iterator(pFirst, 0); }
+      const_iterator cend() const;
+
+      // set-specific interfaces
+      iterator    find(const T & t);
+      void        insert(const T & t);
+      iterator    erase(iterator it);
+
+   private:
+      //member variables
+      Node * pRoot;
+      Leaf * pFirst;         // the leaves, in order
+      Leaf * pLast;
+      int numElements;
+
+      //member functions
+      static int lowerBound(const T * keys, int num, const T & t);
+      static int upperBound(const T * keys, int num, const T & t);
+      bool insert(Node * pNode, const T & t, T & keyUp, Node *& pNodeUp);
+      bool erase(Node * pNode, const T & t);
+      void rebalance(Inner * pParent, int iChild);
+      void removeChild(Inner * pParent, int iKey);
+      Node * copy(const Node * pNode, Leaf *& pPrevLeaf);
+      void destroy(Node * pNode);
+   }; // end class declaration
+
+/************************************************** CONSTRUCTOR DEFINITION ***/
+
+   /*******************************************
+    * BSET :: COPY CONSTRUCTOR
+    *******************************************/
+   template <class T>
+   bset<T> :: bset(const bset <T> & rhs) :
+      pRoot{ nullptr }, pFirst{ nullptr }, pLast{ nullptr }, numElements{ 0 }
+   {
+      *this = rhs;
+   }
+
+/***************************************** OVERLOADED OPERATORS DEFINITION ***/
+
+   /********************************************
+    * BSET : ASSIGNMENT OPERATOR OVERLOAD
+    * Copies the tree node for node, so it is
+    * O(n) instead of n inserts
+    ********************************************/
+   template <class T>
+   bset <T> & bset <T> :: operator = (const bset <T> & rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      clear();
+      if (rhs.pRoot == nullptr)
+         return *this;
+
+      Leaf * pPrevLeaf = nullptr;
+      pRoot = copy(rhs.pRoot, pPrevLeaf);
+      pLast = pPrevLeaf;
+      numElements = rhs.numElements;
+      return *this;
+   }
+
+/************************************** SET SPECIFIC INTERFACES DEFINITION ***/
+
+   /********************************************
+    * BSET : CLEAR
+    * Release every node
+    *******************************************/
+   template <class T>
+   void bset <T> :: clear()
+   {
+      if (pRoot != nullptr)
+         destroy(pRoot);
+      pRoot = nullptr;
+      pFirst = pLast = nullptr;
+      numElements = 0;
+   }
+
+   /********************************************
+    * BSET : FIND
+    * Return an interator if an element matches
+    * the search, otherwise return an interator
+    * to the end()
+    *******************************************/
+   template <class T>
+   typename bset <T> :: iterator bset <T> :: find(const T & t)
+   {
+      if (pRoot == nullptr)
+         return end();
+
+      // walk down to the one leaf the element can be in
+      Node * pNode = pRoot;
+      while (!pNode->isLeaf)
+      {
+         Inner * pInner = static_cast <Inner *> (pNode);
+         pNode = pInner->children[upperBound(pInner->keys, pInner->numKeys, t)];
+      }
+
+      Leaf * pLeaf = static_cast <Leaf *> (pNode);
+      int i = lowerBound(pLeaf->keys, pLeaf->numKeys, t);
+      if (i < pLeaf->numKeys && pLeaf->keys[i] == t)
+         return iterator(pLeaf, i);
+      return end();
+   }
+
+   /********************************************
+    * BSET : INSERT
+    * Insert an element into the set. If already
+    * existent, do nothing.
+    *******************************************/
+   template <class T>
+   void bset <T> :: insert(const T & t)
+   {
+      // the first element is the first leaf
+      if (pRoot == nullptr)
+      {
+         Leaf * pLeaf = new Leaf;
+         pLeaf->isLeaf = true;
+         pLeaf->numKeys = 1;
+         pLeaf->keys[0] = t;
+         pLeaf->pNext = pLeaf->pPrev = nullptr;
+         pRoot = pFirst = pLast = pLeaf;
+         numElements = 1;
+         return;
+      }
+
+      T keyUp;
+      Node * pNodeUp = nullptr;
+      if (insert(pRoot, t, keyUp, pNodeUp))
+         numElements++;
+
+      // the root was split: the tree grows by one level
+      if (pNodeUp != nullptr)
+      {
+         Inner * pInner = new Inner;
+         pInner->isLeaf = false;
+         pInner->numKeys = 1;
+         pInner->keys[0] = keyUp;
+         pInner->children[0] = pRoot;
+         pInner->children[1] = pNodeUp;
+         pRoot = pInner;
+      }
+   }
+
+   /********************************************
+    * BSET : ERASE
+    * Find and erase an element from the set.
+    * Returns the element that followed it
+    *******************************************/
+   template <class T>
+   typename bset <T> :: iterator bset <T> :: erase(iterator it)
+   {
+      if (it == end())
+         return it;
+
+      // nodes may merge, so remember the next element by value
+      T element = *it;
+      iterator itNext = it;
+      ++itNext;
+      bool hasNext = (itNext != end());
+      T next;
+      if (hasNext)
+         next = *itNext;
+
+      if (erase(pRoot, element))
+         numElements--;
+
+      // an inner root with a single child is not needed anymore
+      if (!pRoot->isLeaf && pRoot->numKeys == 0)
+      {
+         Node * pOld = pRoot;
+         pRoot = static_cast <Inner *> (pOld)->children[0];
+         delete static_cast <Inner *> (pOld);
+      }
+      // and an empty leaf root means an empty set
+      else if (pRoot->isLeaf && pRoot->numKeys == 0)
+      {
+         delete static_cast <Leaf *> (pRoot);
+         pRoot = nullptr;
+         pFirst = pLast = nullptr;
+      }
+
+      return hasNext ? find(next) : end();
+   }
+
+/******************************************** PRIVATE FUNCTIONS DEFINITION ***/
+
+   /********************************************
+    * BSET : LOWER BOUND
+    * The first key that is not less than t
+    *******************************************/
+   template <class T>
+   int bset <T> :: lowerBound(const T * keys, int num, const T & t)
+   {
+      int indexBegin = 0;
+      int indexEnd = num;
+      while (indexBegin < indexEnd)
+      {
+         int indexMiddle = (indexBegin + indexEnd) / 2;
+         if (keys[indexMiddle] < t)
+            indexBegin = indexMiddle + 1;
+         else
+            indexEnd = indexMiddle;
+      }
+      return indexBegin;
+   }
+
+   /********************************************
+    * BSET : UPPER BOUND
+    * The first key that is greater than t: the
+    * child of an inner node where t belongs
+    *******************************************/
+   template <class T>
+   int bset <T> :: upperBound(const T * keys, int num, const T & t)
+   {
+      int indexBegin = 0;
+      int indexEnd = num;
+      while (indexBegin < indexEnd)
+      {
+         int indexMiddle = (indexBegin + indexEnd) / 2;
+         if (t < keys[indexMiddle])
+            indexEnd = indexMiddle;
+         else
+            indexBegin = indexMiddle + 1;
+      }
+      return indexBegin;
+   }
+
+   /********************************************
+    * BSET : INSERT (RECURSIVE)
+    * Insert under pNode. If pNode had to be split,
+    * its new right half and the key separating the
+    * two are handed back to be put in the parent
+    *******************************************/
+   template <class T>
+   bool bset <T> :: insert(Node * pNode, const T & t, T & keyUp, Node *& pNodeUp)
+   {
+      pNodeUp = nullptr;
+
+      if (pNode->isLeaf)
+      {
+         Leaf * pLeaf = static_cast <Leaf *> (pNode);
+         int iInsert = lowerBound(pLeaf->keys, pLeaf->numKeys, t);
+
+         //if it's already there, don't do anything
+         if (iInsert < pLeaf->numKeys && pLeaf->keys[iInsert] == t)
+            return false;
+
+         // shift the larger elements up one slot
+         for (int i = pLeaf->numKeys; i > iInsert; i--)
+            pLeaf->keys[i] = pLeaf->keys[i - 1];
+         pLeaf->keys[iInsert] = t;
+         pLeaf->numKeys++;
+
+         if (pLeaf->numKeys <= LEAF_MAX)
+            return true;
+
+         // too full: the upper half moves to a new leaf
+         Leaf * pRight = new Leaf;
+         pRight->isLeaf = true;
+         int iMiddle = pLeaf->numKeys / 2;
+         pRight->numKeys = pLeaf->numKeys - iMiddle;
+         for (int i = 0; i < pRight->numKeys; i++)
+            pRight->keys[i] = pLeaf->keys[iMiddle + i];
+         pLeaf->numKeys = iMiddle;
+
+         // and is linked in after this one
+         pRight->pPrev = pLeaf;
+         pRight->pNext = pLeaf->pNext;
+         if (pLeaf->pNext)
+            pLeaf->pNext->pPrev = pRight;
+         else
+            pLast = pRight;
+         pLeaf->pNext = pRight;
+
+         keyUp = pRight->keys[0];
+         pNodeUp = pRight;
+         return true;
+      }
+
+      Inner * pInner = static_cast <Inner *> (pNode);
+      int iChild = upperBound(pInner->keys, pInner->numKeys, t);
+      T keyChild;
+      Node * pChild = nullptr;
+      bool inserted = insert(pInner->children[iChild], t, keyChild, pChild);
+      if (pChild == nullptr)
+         return inserted;
+
+      // the child was split: its right half goes right after it
+      for (int i = pInner->numKeys; i > iChild; i--)
+      {
+         pInner->keys[i] = pInner->keys[i - 1];
+         pInner->children[i + 1] = pInner->children[i];
+      }
+      pInner->keys[iChild] = keyChild;
+      pInner->children[iChild + 1] = pChild;
+      pInner->numKeys++;
+
+      if (pInner->numKeys <= INNER_MAX)
+         return inserted;
+
+      // too full: the middle key moves up, the keys after it move right
+      Inner * pRight = new Inner;
+      pRight->isLeaf = false;
+      int iMiddle = pInner->numKeys / 2;
+      pRight->numKeys = pInner->numKeys - iMiddle - 1;
+      for (int i = 0; i < pRight->numKeys; i++)
+         pRight->keys[i] = pInner->keys[iMiddle + 1 + i];
+      for (int i = 0; i <= pRight->numKeys; i++)
+         pRight->children[i] = pInner->children[iMiddle + 1 + i];
+      pInner->numKeys = iMiddle;
+
+      keyUp = pInner->keys[iMiddle];
+      pNodeUp = pRight;
+      return inserted;
+   }
+
+   /********************************************
+    * BSET : ERASE (RECURSIVE)
+    * Erase t under pNode, then top up any child
+    * left less than half full
+    *******************************************/
+   template <class T>
+   bool bset <T> :: erase(Node * pNode, const T & t)
+   {
+      if (pNode->isLeaf)
+      {
+         Leaf * pLeaf = static_cast <Leaf *> (pNode);
+         int iErase = lowerBound(pLeaf->keys, pLeaf->numKeys, t);
+         if (iErase == pLeaf->numKeys || !(pLeaf->keys[iErase] == t))
+            return false;
+
+         //move everything down and erase it by overwriting it
+         for (int i = iErase; i < pLeaf->numKeys - 1; i++)
+            pLeaf->keys[i] = pLeaf->keys[i + 1];
+         pLeaf->numKeys--;
+         return true;
+      }
+
+      // a key of an inner node may be a copy of the erased element.
+      //    It still separates its children correctly, so it stays
+      Inner * pInner = static_cast <Inner *> (pNode);
+      int iChild = upperBound(pInner->keys, pInner->numKeys, t);
+      if (!erase(pInner->children[iChild], t))
+         return false;
+
+      Node * pChild = pInner->children[iChild];
+      if (pChild->numKeys < (pChild->isLeaf ? LEAF_MIN : INNER_MIN))
+         rebalance(pInner, iChild);
+      return true;
+   }
+
+   /********************************************
+    * BSET : REBALANCE
+    * A child is less than half full: borrow from
+    * a sibling that can spare a key, otherwise
+    * merge with a sibling
+    *******************************************/
+   template <class T>
+   void bset <T> :: rebalance(Inner * pParent, int iChild)
+   {
+      Node * pChild = pParent->children[iChild];
+      Node * pLeft  = (iChild > 0 ? pParent->children[iChild - 1] : nullptr);
+      Node * pRight = (iChild < pParent->numKeys ?
+                       pParent->children[iChild + 1] : nullptr);
+
+      if (pChild->isLeaf)
+      {
+         Leaf * pLeaf = static_cast <Leaf *> (pChild);
+         Leaf * pLeftLeaf  = static_cast <Leaf *> (pLeft);
+         Leaf * pRightLeaf = static_cast <Leaf *> (pRight);
+
+         // borrow the last element of the left sibling
+         if (pLeftLeaf && pLeftLeaf->numKeys > LEAF_MIN)
+         {
+            for (int i = pLeaf->numKeys; i > 0; i--)
+               pLeaf->keys[i] = pLeaf->keys[i - 1];
+            pLeaf->keys[0] = pLeftLeaf->keys[--pLeftLeaf->numKeys];
+            pLeaf->numKeys++;
+            pParent->keys[iChild - 1] = pLeaf->keys[0];
+         }
+         // borrow the first element of the right sibling
+         else if (pRightLeaf && pRightLeaf->numKeys > LEAF_MIN)
+         {
+            pLeaf->keys[pLeaf->numKeys++] = pRightLeaf->keys[0];
+            for (int i = 0; i < pRightLeaf->numKeys - 1; i++)
+               pRightLeaf->keys[i] = pRightLeaf->keys[i + 1];
+            pRightLeaf->numKeys--;
+            pParent->keys[iChild] = pRightLeaf->keys[0];
+         }
+         // merge the right one of the pair into the left one
+         else
+         {
+            int iKey = (pLeftLeaf ? iChild - 1 : iChild);
+            Leaf * pInto = (pLeftLeaf ? pLeftLeaf : pLeaf);
+            Leaf * pFrom = (pLeftLeaf ? pLeaf : pRightLeaf);
+            for (int i = 0; i < pFrom->numKeys; i++)
+               pInto->keys[pInto->numKeys + i] = pFrom->keys[i];
+            pInto->numKeys += pFrom->numKeys;
+
+            pInto->pNext = pFrom->pNext;
+            if (pFrom->pNext)
+               pFrom->pNext->pPrev = pInto;
+            else
+               pLast = pInto;
+
+            delete pFrom;
+            removeChild(pParent, iKey);
+         }
+         return;
+      }
+
+      Inner * pInner = static_cast <Inner *> (pChild);
+      Inner * pLeftInner  = static_cast <Inner *> (pLeft);
+      Inner * pRightInner = static_cast <Inner *> (pRight);
+
+      // rotate the last child of the left sibling through the parent
+      if (pLeftInner && pLeftInner->numKeys > INNER_MIN)
+      {
+         for (int i = pInner->numKeys; i > 0; i--)
+            pInner->keys[i] = pInner->keys[i - 1];
+         for (int i = pInner->numKeys + 1; i > 0; i--)
+            pInner->children[i] = pInner->children[i - 1];
+         pInner->keys[0] = pParent->keys[iChild - 1];
+         pInner->children[0] = pLeftInner->children[pLeftInner->numKeys];
+         pInner->numKeys++;
+         pParent->keys[iChild - 1] = pLeftInner->keys[--pLeftInner->numKeys];
+      }
+      // rotate the first child of the right sibling through the parent
+      else if (pRightInner && pRightInner->numKeys > INNER_MIN)
+      {
+         pInner->keys[pInner->numKeys] = pParent->keys[iChild];
+         pInner->children[pInner->numKeys + 1] = pRightInner->children[0];
+         pInner->numKeys++;
+         pParent->keys[iChild] = pRightInner->keys[0];
+         for (int i = 0; i < pRightInner->numKeys - 1; i++)
+            pRightInner->keys[i] = pRightInner->keys[i + 1];
+         for (int i = 0; i < pRightInner->numKeys; i++)
+            pRightInner->children[i] = pRightInner->children[i + 1];
+         pRightInner->numKeys--;
+      }
+      // merge the pair, pulling their separator down between them
+      else
+      {
+         int iKey = (pLeftInner ? iChild - 1 : iChild);
+         Inner * pInto = (pLeftInner ? pLeftInner : pInner);
+         Inner * pFrom = (pLeftInner ? pInner : pRightInner);
+         pInto->keys[pInto->numKeys] = pParent->keys[iKey];
+         for (int i = 0; i < pFrom->numKeys; i++)
+            pInto->keys[pInto->numKeys + 1 + i] = pFrom->keys[i];
+         for (int i = 0; i <= pFrom->numKeys; i++)
+            pInto->children[pInto->numKeys + 1 + i] = pFrom->children[i];
+         pInto->numKeys += pFrom->numKeys + 1;
+
+         delete pFrom;
+         removeChild(pParent, iKey);
+      }
+   }
+
+   /********************************************
+    * BSET : REMOVE CHILD
+    * Take a key and the child after it out of an
+    * inner node, once that child was merged away
+    *******************************************/
+   template <class T>
+   void bset <T> :: removeChild(Inner * pParent, int iKey)
+   {
+      for (int i = iKey; i < pParent->numKeys - 1; i++)
+         pParent->keys[i] = pParent->keys[i + 1];
+      for (int i = iKey + 1; i < pParent->numKeys; i++)
+         pParent->children[i] = pParent->children[i + 1];
+      pParent->numKeys--;
+   }
+
+   /********************************************
+    * BSET : COPY
+    * Copy a subtree, linking its leaves after
+    * the last leaf copied so far
+    *******************************************/
+   template <class T>
+   typename bset <T> :: Node * bset <T> :: copy(const Node * pNode,
+                                                Leaf *& pPrevLeaf)
+   {
+      if (pNode->isLeaf)
+      {
+         const Leaf * pSource = static_cast <const Leaf *> (pNode);
+         Leaf * pLeaf = new Leaf;
+         pLeaf->isLeaf = true;
+         pLeaf->numKeys = pSource->numKeys;
+         for (int i = 0; i < pSource->numKeys; i++)
+            pLeaf->keys[i] = pSource->keys[i];
+
+         pLeaf->pPrev = pPrevLeaf;
+         pLeaf->pNext = nullptr;
+         if (pPrevLeaf)
+            pPrevLeaf->pNext = pLeaf;
+         else
+            pFirst = pLeaf;
+         pPrevLeaf = pLeaf;
+         return pLeaf;
+      }
+
+      const Inner * pSource = static_cast <const Inner *> (pNode);
+      Inner * pInner = new Inner;
+      pInner->isLeaf = false;
+      pInner->numKeys = pSource->numKeys;
+      for (int i = 0; i < pSource->numKeys; i++)
+         pInner->keys[i] = pSource->keys[i];
+      for (int i = 0; i <= pSource->numKeys; i++)
+         pInner->children[i] = copy(pSource->children[i], pPrevLeaf);
+      return pInner;
+   }
+
+   /********************************************
+    * BSET : DESTROY
+    * Release a subtree
+    *******************************************/
+   template <class T>
+   void bset <T> :: destroy(Node * pNode)
+   {
+      if (pNode->isLeaf)
+      {
+         delete static_cast <Leaf *> (pNode);
+         return;
+      }
+
+      Inner * pInner = static_cast <Inner *> (pNode);
+      for (int i = 0; i <= pInner->numKeys; i++)
+         destroy(pInner->children[i]);
+      delete pInner;
+   }
+
+/***************************************************** ITERATOR DEFINITION ***/
+
+   /**************************************************
+    * BSET ITERATOR
+    * An iterator through the leaves of the bset.
+    * The end is one past the last element of the
+    * last leaf, so it can be decremented
+    *************************************************/
+   template <class T>
+   class bset <T> :: iterator
+   {
+   public:
+      // constructors, destructors, and assignment operator
+      iterator() : p(nullptr), i(0) {}
+      iterator(Leaf * p, int i) : p(p), i(i) {}
+      iterator(const iterator & rhs) { *this = rhs; }
+
+      iterator & operator = (const iterator & rhs)
+      {
+         this->p = rhs.p;
+         this->i = rhs.i;
+         return *this;
+      }
+
+      // equals, not equals operator
+      bool operator != (const iterator & rhs) const { return rhs.p != this->p || rhs.i != this->i; }
+      bool operator == (const iterator & rhs) const { return rhs.p == this->p && rhs.i == this->i; }
+
+      // dereference operator
+            T & operator * ()       { return p->keys[i]; }
+      const T & operator * () const { return p->keys[i]; }
+
+      // prefix increment
+      iterator & operator ++ ()
+      {
+         if (++i == p->numKeys && p->pNext)
+         {
+            p = p->pNext;
+            i = 0;
+         }
+         return *this;
+      }
+
+      // postfix increment
+      iterator operator ++ (int postfix)
+      {
+         iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+      // prefix decrement
+      iterator & operator -- ()
+      {
+         if (i == 0 && p->pPrev)
+         {
+            p = p->pPrev;
+            i = p->numKeys;
+         }
+         i--;
+         return *this;
+      }
+
+      // postfix decrement
+      iterator operator -- (int postfix)
+      {
+         iterator tmp(*this);
+         --(*this);
+         return tmp;
+      }
+
+      private:
+      Leaf * p;
+      int i;
+   };
+
+   /********************************************
+    * BSET :: ITERATOR :: END
+    * Note that you have to use "typename" before
+    * the return value type
+    ********************************************/
+   template <class T>
+   typename bset <T> :: iterator bset <T> :: end()
+   {
+      return (pLast == nullptr ? iterator(nullptr, 0) :
+                                 iterator(pLast, pLast->numKeys));
+   }
+
+   /**************************************************
+    * BSET CONST_ITERATOR
+    * A constant iterator through the leaves of the
+    * bset
+    *************************************************/
+   template <class T>
+   class bset <T> :: const_iterator
+   {
+   public:
+      // constructors, destructors, and assignment operator
+      const_iterator() : p(nullptr), i(0) {}
+      const_iterator(const Leaf * p, int i) : p(p), i(i) {}
+      const_iterator(const const_iterator & rhs) { *this = rhs; }
+
+      const_iterator & operator = (const const_iterator & rhs)
+      {
+         this->p = rhs.p;
+         this->i = rhs.i;
+         return *this;
+      }
+
+      // equals, not equals operator
+      bool operator != (const const_iterator & rhs) const { return rhs.p != this->p || rhs.i != this->i; }
+      bool operator == (const const_iterator & rhs) const { return rhs.p == this->p && rhs.i == this->i; }
+
+      // dereference operator
+      const T & operator * () const { return p->keys[i]; }
+
+      // prefix increment
+      const_iterator & operator ++ ()
+      {
+         if (++i == p->numKeys && p->pNext)
+         {
+            p = p->pNext;
+            i = 0;
+         }
+         return *this;
+      }
+
+      // postfix increment
+      const_iterator operator ++ (int postfix)
+      {
+         const_iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+      // prefix decrement
+      const_iterator & operator -- ()
+      {
+         if (i == 0 && p->pPrev)
+         {
+            p = p->pPrev;
+            i = p->numKeys;
+         }
+         i--;
+         return *this;
+      }
+
+      // postfix decrement
+      const_iterator operator -- (int postfix)
+      {
+         const_iterator tmp(*this);
+         --(*this);
+         return tmp;
+      }
+
+   private:
+      const Leaf * p;
+      int i;
+   };
+
+   /********************************************
+    * BSET :: ITERATOR :: CEND
+    * Note that you have to use "typename" before
+    * the return value type
+    ********************************************/
+   template <class T>
+   typename bset <T> :: const_iterator bset <T> :: cend() const
+   {
+      return (pLast == nullptr ? const_iterator(nullptr, 0) :
+                                 const_iterator(pLast, pLast->numKeys));
+   }
+}; //end namespace custom
+
+#endif // BSET_H
@@ -0,0 +1,263 @@
+/***********************************************************************
+* Header:
+*    CATALOG
+* Summary:
+*    This class contains the notion of a catalog: the list of names a
+*    vertex can take, read from a file instead of being written into
+*    the program like the courses of CourseVertex.
+*    Of particular interest is the lookup from a name to its index:
+*    a perfect hash built when the catalog is read, so finding a name
+*    costs two hashes and one comparison no matter how long the list.
+*
+*    This will contain the class definition of:
+*       Catalog             : the names, in the order they were read
+*       CatalogVertex       : a vertex whose text comes from a catalog
+* Author
+*    Daniel Perez, Jamie Hurd, Benjamin Dyas
+************************************************************************/
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <fstream>
+#include <string>
+#include "vertex.h"
+#include "vector.h"
+
+/************************************************
+ * CATALOG
+ * The names of the verticies of a graph. The hash
+ * is a "hash and displace" perfect hash: a first
+ * hash picks a small bucket of names, and every
+ * bucket remembers the seed that sends each of its
+ * names to a slot of its own
+ ***********************************************/
+class Catalog
+{
+public:
+   Catalog() : numBuckets(0), numSlots(0) {}
+
+   // read every name in a file or a stream. A "|" is not a name,
+   //    so a dependency list such as cs.txt is also a catalog
+   bool read(const char * fileName);
+   void read(std::istream & in);
+
+   // standard container interfaces
+   int  size()  const { return names.size();   }
+   bool empty() const { return names.empty();  }
+
+   // the bounds of the verticies named by this catalog
+   VertexDomain getDomain() const { return VertexDomain(empty() ? 1 : size()); }
+
+   // translate between a name and its index. -1 means no such name
+   int indexFromName(const char * s, std::size_t length) const;
+   int indexFromName(const string & s) const
+   {
+      return indexFromName(s.data(), s.size());
+   }
+   const string & nameFromIndex(int i) const
+   {
+      assert(i >= 0 && i < size());
+      return names[i];
+   }
+
+private:
+   custom::vector<string> names;         // index --> name
+   custom::vector<unsigned int> seeds;   // bucket --> seed of its names
+   custom::vector<int> slots;            // slot --> index, or -1
+   int numBuckets;                       // both are powers of two
+   int numSlots;
+
+   int bucketOf(const char * s, std::size_t length) const
+   {
+      return labelHash(s, length, 0) & (numBuckets - 1);
+   }
+   void build(const custom::vector<string> & tokens);
+   bool place(const custom::vector<int> & first,
+              const custom::vector<int> & next);
+};
+
+/**********************************************
+ * CATALOG : READ
+ * Read the names from a file
+ **********************************************/
+inline bool Catalog::read(const char * fileName)
+{
+   std::ifstream fin(fileName);
+   if (fin.fail())
+      return false;
+   read(fin);
+   fin.close();
+   return true;
+}
+
+/**********************************************
+ * CATALOG : READ
+ * Read the names from a stream and hash them
+ **********************************************/
+inline void Catalog::read(std::istream & in)
+{
+   custom::vector<string> tokens;
+   string s;
+   while (in >> s)
+      if (s != "|")
+         tokens.push_back(s);
+   build(tokens);
+}
+
+/**********************************************
+ * CATALOG : INDEX FROM NAME
+ * Find the one slot the name can live in
+ **********************************************/
+inline int Catalog::indexFromName(const char * s, std::size_t length) const
+{
+   if (empty())
+      return -1;
+
+   unsigned int seed = seeds[bucketOf(s, length)];
+   int index = slots[labelHash(s, length, seed) & (numSlots - 1)];
+
+   // any text can land on a slot, so it still has to match
+   if (index < 0 || names[index].compare(0, string::npos, s, length) != 0)
+      return -1;
+   return index;
+}
+
+/**********************************************
+ * CATALOG : BUILD
+ * Keep the first of every name and hash them all
+ **********************************************/
+inline void Catalog::build(const custom::vector<string> & tokens)
+{
+   // half as many buckets as names and twice as many slots
+   numBuckets = 1;
+   while (numBuckets * 2 < tokens.size())
+      numBuckets *= 2;
+   numSlots = 1;
+   while (numSlots < tokens.size() * 2)
+      numSlots *= 2;
+
+   // drop the duplicates: the same name is always in the same bucket
+   custom::vector<int> first(numBuckets, -1);
+   custom::vector<int> next(tokens.size() + 1, -1);
+   custom::vector<string> unique;
+   for (int i = 0; i < tokens.size(); i++)
+   {
+      int bucket = bucketOf(tokens[i].data(), tokens[i].size());
+      bool duplicate = false;
+      for (int j = first[bucket]; j != -1 && !duplicate; j = next[j])
+         duplicate = (unique[j] == tokens[i]);
+      if (duplicate)
+         continue;
+
+      next[unique.size()] = first[bucket];
+      first[bucket] = unique.size();
+      unique.push_back(tokens[i]);
+   }
+   names = unique;
+
+   // the seeds can always be found given enough room
+   while (!place(first, next))
+      numSlots *= 2;
+}
+
+/**********************************************
+ * CATALOG : PLACE
+ * Search a seed for every bucket, fullest first,
+ * such that its names land on free slots
+ **********************************************/
+inline bool Catalog::place(const custom::vector<int> & first,
+                           const custom::vector<int> & next)
+{
+   seeds = custom::vector<unsigned int>(numBuckets, 0);
+   slots = custom::vector<int>(numSlots, -1);
+
+   // how full is every bucket?
+   custom::vector<int> count(numBuckets, 0);
+   int maxCount = 0;
+   for (int bucket = 0; bucket < numBuckets; bucket++)
+   {
+      for (int j = first[bucket]; j != -1; j = next[j])
+         count[bucket]++;
+      if (count[bucket] > maxCount)
+         maxCount = count[bucket];
+   }
+
+   for (int size = maxCount; size > 0; size--)
+      for (int bucket = 0; bucket < numBuckets; bucket++)
+      {
+         if (count[bucket] != size)
+            continue;
+
+         bool placed = false;
+         for (unsigned int seed = 1; seed < 4096 && !placed; seed++)
+         {
+            // claim the slots, giving them all back on a collision
+            placed = true;
+            for (int j = first[bucket]; j != -1; j = next[j])
+            {
+               int slot = labelHash(names[j].data(), names[j].size(), seed)
+                          & (numSlots - 1);
+               if (slots[slot] != -1)
+               {
+                  for (int k = first[bucket]; k != j; k = next[k])
+                     slots[labelHash(names[k].data(), names[k].size(), seed)
+                           & (numSlots - 1)] = -1;
+                  placed = false;
+                  break;
+               }
+               slots[slot] = j;
+            }
+            if (placed)
+               seeds[bucket] = seed;
+         }
+
+         if (!placed)
+            return false;
+      }
+
+   return true;
+}
+
+/****************************************************
+ * CATALOG  VERTEX
+ * A vertex whose names come from a catalog. The
+ * catalog has to outlive the verticies using it
+ ***************************************************/
+class CatalogVertex : public Vertex
+{
+public:
+   CatalogVertex() : catalog(nullptr) { }
+   CatalogVertex(const Catalog & catalog) :
+      Vertex(-1, catalog.getDomain()), catalog(&catalog) { }
+
+   // return the text version of the index: 0 --> the first name read
+   string getText() const
+   {
+      if (catalog == nullptr || i < 0)
+         return string("ERROR");
+      return catalog->nameFromIndex(i);
+   }
+
+   int writeText(char * buffer, int size) const
+   {
+      if (catalog == nullptr || i < 0)
+         return copyText(buffer, size, "ERROR", 5);
+      const string & name = catalog->nameFromIndex(i);
+      return copyText(buffer, size, name.data(), name.size());
+   }
+
+   // set an index based on the text
+   bool setText(const string & s)
+   {
+      int index = (catalog == nullptr ? -1 : catalog->indexFromName(s));
+      if (index < 0)
+         return false;
+      this->i = index;
+      return true;
+   }
+
+private:
+   const Catalog * catalog;
+};
+
+#endif // CATALOG_H
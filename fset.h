@@ -0,0 +1,358 @@
+/***********************************************************************
+* Header:
+*    FSET
+* Summary:
+*    This class contains the notion of a frozen set: a set that is
+*    built once from a custom::set and from then on only searched.
+*    Of particular interest is the order of the array: Eytzinger (or
+*    breadth first) order, where the children of item k are items 2k
+*    and 2k+1. The first steps of every search share the same few
+*    cache lines, and the items a search will need a few steps later
+*    are next to each other, so they are prefetched while it goes.
+*
+*    This will contain the class definition of:
+*       fset                : a read-only set
+*       fset :: iterator    : an iterator through the fset, in order
+* Author
+*    Daniel Perez, Benjamin Dyas
+************************************************************************/
+#ifndef FSET_H
+#define FSET_H
+
+#include "set.h"
+
+namespace custom
+{
+   /************************************************
+    * FSET
+    * Container class that holds unique values in
+    * Eytzinger order. data[0] is not used, the
+    * root is data[1]
+    ***********************************************/
+   template <class T>
+   class fset
+   {
+   public:
+      // constructors & destructor
+      fset() : data{ nullptr }, numElements{ 0 }, numFullLevels{ 0 } {}
+      template <int N>
+      explicit fset(const set <T, N> & rhs);
+      fset(const fset & rhs);
+      ~fset() { clear(); }
+
+      // overloaded operators
+      fset & operator = (const fset & rhs);
+      template <int N>
+      fset & operator = (const set <T, N> & rhs);
+
+      // standard container interfaces
+      int   size()      const { return numElements; }
+      bool  empty()     const { return (numElements == 0); }
+      void  clear();
+
+      // the various iterator interfaces. Nothing can be changed, so
+      //    both iterators are constant
+      class const_iterator;
+      typedef const_iterator iterator;
+      const_iterator begin()  const { return cbegin(); }
+      const_iterator end()    const { return cend();   }
+      const_iterator cbegin() const;
+      const_iterator cend()   const { return const_iterator(this, 0); }
+
+      // set-specific interfaces
+      const_iterator find(const T & t) const;
+
+   private:
+      //member variables
+      T * data;        // dynamically allocated array of T
+      int numElements;
+      int numFullLevels; // levels of the tree with no item missing
+
+      //member functions
+      template <int N>
+      void copy(const set <T, N> & rhs);
+      template <int N>
+      int  fill(const set <T, N> & rhs, int iSorted, int k);
+   }; // end class declaration
+
+/************************************************** CONSTRUCTOR DEFINITION ***/
+
+   /*******************************************
+    * FSET :: FREEZE CONSTRUCTOR
+    * Lay out a set in Eytzinger order
+    *******************************************/
+   template <class T>
+   template <int N>
+   fset<T> :: fset(const set <T, N> & rhs) :
+      data{ nullptr }, numElements{ 0 }, numFullLevels{ 0 }
+   {
+      copy(rhs);
+   }
+
+   /*******************************************
+    * FSET :: COPY CONSTRUCTOR
+    *******************************************/
+   template <class T>
+   fset<T> :: fset(const fset <T> & rhs) :
+      data{ nullptr }, numElements{ 0 }, numFullLevels{ 0 }
+   {
+      *this = rhs;
+   }
+
+/***************************************** OVERLOADED OPERATORS DEFINITION ***/
+
+   /********************************************
+    * FSET : ASSIGNMENT OPERATOR OVERLOAD
+    ********************************************/
+   template <class T>
+   fset <T> & fset <T> :: operator = (const fset <T> & rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      clear();
+      if (rhs.numElements == 0)
+         return *this;
+
+      try
+      {
+         data = new T[rhs.numElements + 1];
+      }
+      catch (...)
+      {
+         throw "ERROR: Unable to allocate a new buffer for fset.";
+      }
+
+      // it is already in order: a straight copy
+      numElements = rhs.numElements;
+      numFullLevels = rhs.numFullLevels;
+      for (int k = 1; k <= numElements; k++)
+         data[k] = rhs.data[k];
+      return *this;
+   }
+
+   /********************************************
+    * FSET : ASSIGNMENT OPERATOR OVERLOAD
+    * Freeze a set in place of this one
+    ********************************************/
+   template <class T>
+   template <int N>
+   fset <T> & fset <T> :: operator = (const set <T, N> & rhs)
+   {
+      clear();
+      copy(rhs);
+      return *this;
+   }
+
+/************************************** SET SPECIFIC INTERFACES DEFINITION ***/
+
+   /********************************************
+    * FSET : CLEAR
+    *******************************************/
+   template <class T>
+   void fset <T> :: clear()
+   {
+      if (data != nullptr)
+         delete [] data;
+      data = nullptr;
+      numElements = 0;
+      numFullLevels = 0;
+   }
+
+   /********************************************
+    * FSET : FIND
+    * Return an interator if an element matches
+    * the search, otherwise return an interator
+    * to the end()
+    *******************************************/
+   template <class T>
+   typename fset <T> :: const_iterator fset <T> :: find(const T & t) const
+   {
+      // go left or right without a branch. The 16 great-grandchildren
+      //    four levels down are side by side: ask for them now. Every
+      //    search goes through all the full levels, so the loop always
+      //    runs the same number of times and its end is never mispredicted
+      int k = 1;
+      for (int level = 0; level < numFullLevels; level++)
+      {
+#ifdef __GNUC__
+         __builtin_prefetch(data + 16 * k);
+#endif
+         k = 2 * k + (data[k] < t);
+      }
+
+      // the last level may be partly there
+      bool isInside = (k <= numElements);
+      int kInside = (isInside ? k : 0);
+      k = (isInside ? 2 * k + (data[kInside] < t) : k);
+
+      // every step right since the last step left went past t: undo
+      //    them, and the one step left is to the first item not less
+      //    than t. Zero if there is none
+      while (k & 1)
+         k >>= 1;
+      k >>= 1;
+
+      if (k != 0 && data[k] == t)
+         return const_iterator(this, k);
+      return cend();
+   }
+
+/******************************************** PRIVATE FUNCTIONS DEFINITION ***/
+
+   /********************************************
+    * FSET : COPY
+    * Allocate and fill from a sorted set
+    *******************************************/
+   template <class T>
+   template <int N>
+   void fset <T> :: copy(const set <T, N> & rhs)
+   {
+      if (rhs.size() == 0)
+         return;
+
+      try
+      {
+         data = new T[rhs.size() + 1];
+      }
+      catch (...)
+      {
+         throw "ERROR: Unable to allocate a new buffer for fset.";
+      }
+
+      numElements = rhs.size();
+      fill(rhs, 0, 1);
+
+      // a tree of L full levels holds 2^L - 1 items
+      while ((2 << numFullLevels) - 1 <= numElements)
+         numFullLevels++;
+   }
+
+   /********************************************
+    * FSET : FILL
+    * An in order walk of the implicit tree under
+    * item k, handing out the sorted items as it
+    * goes. Returns the next sorted item to hand out
+    *******************************************/
+   template <class T>
+   template <int N>
+   int fset <T> :: fill(const set <T, N> & rhs, int iSorted, int k)
+   {
+      if (k > numElements)
+         return iSorted;
+
+      iSorted = fill(rhs, iSorted, 2 * k);
+      data[k] = rhs[iSorted++];
+      return fill(rhs, iSorted, 2 * k + 1);
+   }
+
+   /********************************************
+    * FSET :: CBEGIN
+    * The smallest item is the leftmost one
+    ********************************************/
+   template <class T>
+   typename fset <T> :: const_iterator fset <T> :: cbegin() const
+   {
+      int k = (numElements == 0 ? 0 : 1);
+      while (k != 0 && 2 * k <= numElements)
+         k = 2 * k;
+      return const_iterator(this, k);
+   }
+
+/***************************************************** ITERATOR DEFINITION ***/
+
+   /**************************************************
+    * FSET CONST_ITERATOR
+    * An in order iterator through the implicit tree.
+    * The end is item 0
+    *************************************************/
+   template <class T>
+   class fset <T> :: const_iterator
+   {
+   public:
+      // constructors, destructors, and assignment operator
+      const_iterator() : pSet(nullptr), k(0) {}
+      const_iterator(const fset * pSet, int k) : pSet(pSet), k(k) {}
+      const_iterator(const const_iterator & rhs) { *this = rhs; }
+
+      const_iterator & operator = (const const_iterator & rhs)
+      {
+         this->pSet = rhs.pSet;
+         this->k = rhs.k;
+         return *this;
+      }
+
+      // equals, not equals operator
+      bool operator != (const const_iterator & rhs) const { return rhs.k != this->k; }
+      bool operator == (const const_iterator & rhs) const { return rhs.k == this->k; }
+
+      // dereference operator
+      const T & operator * () const { return pSet->data[k]; }
+
+      // prefix increment: the leftmost item of the right subtree, or
+      //    else the first ancestor this is left of
+      const_iterator & operator ++ ()
+      {
+         if (2 * k + 1 <= pSet->numElements)
+         {
+            k = 2 * k + 1;
+            while (2 * k <= pSet->numElements)
+               k = 2 * k;
+         }
+         else
+         {
+            while (k & 1)
+               k >>= 1;
+            k >>= 1;
+         }
+         return *this;
+      }
+
+      // postfix increment
+      const_iterator operator ++ (int postfix)
+      {
+         const_iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+      // prefix decrement: the same, mirrored. The end goes back to
+      //    the rightmost item
+      const_iterator & operator -- ()
+      {
+         if (k == 0)
+         {
+            k = 1;
+            while (2 * k + 1 <= pSet->numElements)
+               k = 2 * k + 1;
+         }
+         else if (2 * k <= pSet->numElements)
+         {
+            k = 2 * k;
+            while (2 * k + 1 <= pSet->numElements)
+               k = 2 * k + 1;
+         }
+         else
+         {
+            while (k > 1 && !(k & 1))
+               k >>= 1;
+            k >>= 1;
+         }
+         return *this;
+      }
+
+      // postfix decrement
+      const_iterator operator -- (int postfix)
+      {
+         const_iterator tmp(*this);
+         --(*this);
+         return tmp;
+      }
+
+   private:
+      const fset * pSet;
+      int k;
+   };
+}; //end namespace custom
+
+#endif // FSET_H
@@ -6,6 +6,10 @@
  *    Daniel Perez, Jamie Hurd, Benjamin Dyas
  * Summary:
  *    Create a graph where the node have directional edges.
+ *
+ *    This will contain the class definition of:
+ *       BasicGraph <VertexT> : a graph of one kind of vertex
+ *       Graph                : a graph of generic Vertex objects
  ************************************************************************/
 
 
@@ -18,72 +22,346 @@
 #include "queue.h"
 #include "vector.h"
 
+#define GRAPH_INLINE_EDGES 4   // edges kept inside the set of each vertex
+
 namespace custom
 {
    /************************************************
-    * CLASS: GRAPH
+    * CLASS: BASIC GRAPH
     * Container class element that contains info
-    * for an array-of-sets graph
+    * for an array-of-sets graph. The vertex type is
+    * fixed at compile time: internally only the
+    * vertex indices are stored, one set of
+    * destination indices per possible source, so
+    * nothing is ever sliced and no virtual function
+    * is called. Typed verticies are rebuilt from an
+    * index and a vertex of the same graph.
     ***********************************************/
-   class Graph
+   template <class VertexT>
+   class BasicGraph
    {
       private:
-         //support class: It holds a source vertex and
-         //   all possible vertices that it can form an edge
-         //   with; denoted by source and destinations.
-         //   it also holds useful information like a flag
-         //   for whether a vertex has been visited yet
-         //   and which vertex it was visited from (parent).
-         //   arrayIndex helps to avoid unnecessary searches
-         //   and copies by holding a value of where the 
-         //   array is storing a vertex (by it's index)
-         class SourceVertex 
-         {
-            public:
-            SourceVertex() : source{nullptr}, destinations{nullptr},
-                             arrayIndex{-1}, visited{false}, parent{-1} {}
-            ~SourceVertex() 
-            {
-               if(source)
-                  delete source;
-               if(destinations)
-                  destinations->clear();
-            }
+         //one set of destination indices per source index. Most verticies
+         //   have a few edges, which then need no allocation at all
+         typedef set<int, GRAPH_INLINE_EDGES> Edges;
+         Edges * edges;
+         int num;
+         VertexDomain domain; // bounds of the verticies in this graph
 
-            Vertex * source;
-            set<Vertex> * destinations;
-            int arrayIndex;
-            int parent;
-            bool visited;
+         //allocate and copy helpers shared by the constructors
+         void allocate(int num);
+         void copy(const BasicGraph & rhs);
 
-         };
+         //is this vertex one that can be stored in this graph?
+         bool isValid(const VertexT & v) const
+         {
+            return v.index() >= 0 && v.index() < num;
+         }
 
-         //other private member variables
-         SourceVertex * vertices;
-         int num;
-         int numCapacity;
-         
+         //rebuild a typed vertex from its index. Everything else the
+         //   vertex carries (its domain, its catalog) is copied from one
+         //   of the same graph
+         VertexT vertexFromIndex(int index, const VertexT & like) const
+         {
+            VertexT v(like);
+            v.Vertex::set(index);
+            return v;
+         }
 
       public:
          //CONSTRUCTORS AND DESTRUCTOR
-         Graph (int num);
-         Graph (const Graph & rhs);
-         ~Graph () { clear(); }
-         
+         BasicGraph (int num);
+         BasicGraph (const VertexDomain & domain);
+         BasicGraph (const BasicGraph & rhs);
+         ~BasicGraph () { clear(); }
+
          // standard Graph interfaces
          int size () const { return num; }
-         int capacity() const {return numCapacity;}
+         int capacity() const {return num;}
+         const VertexDomain & getDomain() const { return domain; }
          void clear ();
-         void add (Vertex v1, Vertex v2);
-         void add (Vertex v1, const set<Vertex> & s);
-         bool isEdge( Vertex v1, Vertex v2) const;
-         set<Vertex> findEdges (Vertex v);
-         vector<Vertex> findPath (Vertex source, Vertex destination);
-         
+         void add (const VertexT & v1, const VertexT & v2);
+         void add (const VertexT & v1, const set<VertexT> & s);
+         bool isEdge(const VertexT & v1, const VertexT & v2) const;
+         set<VertexT> findEdges (const VertexT & v) const;
+         vector<VertexT> findPath (const VertexT & source,
+                                   const VertexT & destination) const;
+
 
          //OVERLOADED OPERATORS
-            Graph & operator= (const Graph &rhs);
+            BasicGraph & operator= (const BasicGraph &rhs);
 
    };
+
+   // the graph of generic verticies used by the maze and the drivers
+   typedef BasicGraph<Vertex> Graph;
+
+   /********************************************
+    * CONSTRUCTOR:    NON-DEFAULT CONSTRUCTOR
+    ********************************************/
+   template <class VertexT>
+   BasicGraph<VertexT>::BasicGraph(int num) : domain(num < 1 ? 1 : num)
+   {
+      allocate(num);
+   }
+
+   /********************************************
+    * CONSTRUCTOR:    DOMAIN CONSTRUCTOR
+    * PARAMETER:      The bounds of the verticies
+    *                 this graph will hold
+    ********************************************/
+   template <class VertexT>
+   BasicGraph<VertexT>::BasicGraph(const VertexDomain & domain) :
+      domain(domain)
+   {
+      //One slot for every possible vertex
+      allocate(domain.getMax());
+   }
+
+   /********************************************
+    * COPYCONSTRUCTOR: COPY CONSTRUCTOR
+    * PARAMETER:      A const Graph to copy
+    ********************************************/
+   template <class VertexT>
+   BasicGraph<VertexT>::BasicGraph(const BasicGraph<VertexT> &rhs) :
+      domain(rhs.domain)
+   {
+      allocate(rhs.size());
+      copy(rhs);
+   }
+
+   /********************************************
+    * ASSIGNOVERLOAD: ASSIGNMENT OPERATOR
+    * PARAMETER:      A const Graph to copy
+    ********************************************/
+   template <class VertexT>
+   BasicGraph<VertexT> & BasicGraph<VertexT>::operator= (const BasicGraph<VertexT> &rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      // clear this graph before assigning rhs values
+      clear();
+      domain = rhs.domain;
+      allocate(rhs.size());
+      copy(rhs);
+
+      return *this;
+   }
+
+   /********************************************
+    * FUNCTION:     ALLOCATE
+    * DESCRIPTION:  allocates one empty set of
+    *               destinations per vertex
+    * PARAMETER:    the number of verticies
+    ********************************************/
+   template <class VertexT>
+   void BasicGraph<VertexT>::allocate(int num)
+   {
+      //Get size of Graph
+      this->num = num < 0 ? 0 : num;
+      this->edges = nullptr;
+
+      //Try to allocate an array to hold the Graph
+      try
+      {
+         if (this->num > 0)
+            this->edges = new Edges[this->num];
+      }
+      catch (std::exception &e)
+      {
+         this->num = 0;
+         throw ("New allocation error");
+      }
+   }
+
+   /********************************************
+    * FUNCTION:     COPY
+    * DESCRIPTION:  copies the edges of a graph
+    *               of the same size into this one
+    * PARAMETER:    the graph to copy
+    ********************************************/
+   template <class VertexT>
+   void BasicGraph<VertexT>::copy(const BasicGraph<VertexT> & rhs)
+   {
+      //copying of existing destinations (second Vertex in edge)
+      for (int i = 0; i < num; i++)
+         edges[i] = rhs.edges[i];
+   }
+
+   /********************************************
+    * FUNCTION:     CLEAR
+    * DESCRIPTION:  releases all the edges
+    * PARAMETER:    N/A
+    ********************************************/
+   template <class VertexT>
+   void BasicGraph<VertexT>::clear()
+   {
+      //clean-up/memory release
+      if (edges != nullptr)
+      {
+         delete [] edges;
+         //not used, but in case of testing for emptiness
+         edges = nullptr;
+      }
+      num = 0;
+   }
+
+   /********************************************
+    * FUNCTION:     ADD (2 Vertex)
+    * DESCRIPTION:  adds the edge v1 --> v2
+    * PARAMETER:    Takes two vertex objects
+    ********************************************/
+   template <class VertexT>
+   void BasicGraph<VertexT>::add(const VertexT & v1, const VertexT & v2)
+   {
+      if (!isValid(v1) || !isValid(v2))
+         throw "ERROR: vertex is outside of the graph";
+
+      //the index of the source is where its destinations live
+      edges[v1.index()].insert(v2.index());
+   }
+
+   /********************************************
+    * FUNCTION:     ADD (Vertex and set)
+    * DESCRIPTION:  adds an edge from v1 to every
+    *               member of the set
+    * PARAMETER:    Takes one vertex object and
+    *               one set<vertex>
+    ********************************************/
+   template <class VertexT>
+   void BasicGraph<VertexT>::add(const VertexT & v1, const set<VertexT> & s)
+   {
+      typename set<VertexT>::const_iterator it;
+      for (it = s.cbegin(); it != s.cend(); ++it)
+         add(v1, *it);
+   }
+
+   /********************************************
+    * FUNCTION:     ISEDGE
+    * DESCRIPTION:  checks if an edge exists
+    *               between two vertices
+    * PARAMETER:    takes two vertices
+    ********************************************/
+   template <class VertexT>
+   bool BasicGraph<VertexT>::isEdge(const VertexT & v1, const VertexT & v2) const
+   {
+      if (!isValid(v1) || !isValid(v2))
+         return false;
+
+      Edges & destinations = edges[v1.index()];
+      return destinations.find(v2.index()) != destinations.end();
+   }
+
+   /********************************************
+    * FUNCTION:     FINDEDGES
+    * DESCRIPTION:  Finds the edges of a vertex
+    * PARAMETER:    vertex
+    ********************************************/
+   template <class VertexT>
+   set<VertexT> BasicGraph<VertexT>::findEdges(const VertexT & v) const
+   {
+      set<VertexT> s;
+      if (!isValid(v))
+         return s; // returns a empty set
+
+      // the indices are already sorted, so every insert lands at the end
+      Edges & destinations = edges[v.index()];
+      for (Edges::iterator it = destinations.begin();
+           it != destinations.end(); ++it)
+         s.insert(vertexFromIndex(*it, v));
+
+      return s;
+   }
+
+   /********************************************
+    * FUNCTION:     FINDPATH
+    * DESCRIPTION:  Finds the shortest path from
+    *               a source vertex to a
+    *               destination vertex with a
+    *               breadth first search. If the
+    *               destination cannot be reached
+    *               from the source, the path is
+    *               empty
+    * PARAMETER:    takes two vertices
+    ********************************************/
+   template <class VertexT>
+   vector<VertexT> BasicGraph<VertexT>::findPath(const VertexT & source,
+                                                 const VertexT & destination) const
+   {
+      vector<VertexT> path; // store the parent values to contain the path here
+
+      //an invalid endpoint can never be reached: don't bother searching
+      if (!isValid(source) || !isValid(destination))
+         return path;
+
+      //a path to itself is just the one vertex
+      if (source == destination)
+      {
+         path.push_back(vertexFromIndex(source.index(), source));
+         return path;
+      }
+
+      //the breadcrumbs: which vertex each vertex was reached from.
+      //   -1 means not visited yet. The search state is local, so
+      //   several searches can run on the same graph at once
+      vector<int> parent(num, -1);
+      custom::queue<int> toVisit; // all the values to search and store here
+
+      //the source is never revisited
+      parent[source.index()] = source.index();
+      toVisit.push(source.index());
+
+      // traverse through the edges starting at the source value
+      bool found = false;
+      while (!toVisit.empty() && !found)
+      {
+         //save the front value and pop it out of the queue
+         int index = toVisit.front();
+         toVisit.pop();
+
+         //visit every destination of this vertex before moving on to
+         //   the next source vertex
+         Edges & destinations = edges[index];
+         for (Edges::iterator it = destinations.begin();
+              it != destinations.end(); ++it)
+         {
+            if (parent[*it] != -1)
+               continue;
+
+            parent[*it] = index;
+
+            //this is also where the search stops early
+            if (*it == destination.index())
+            {
+               found = true;
+               break;
+            }
+            toVisit.push(*it);
+         }
+      }
+
+      //the whole reachable part of the graph was searched: no path exists
+      if (!found)
+         return path;
+
+      //We traverse the path from the end to the beginning by moving unto the
+      //   next Vertex's parent... following the breadcrumbs
+      for (int index = destination.index(); index != source.index();
+           index = parent[index])
+         path.push_back(vertexFromIndex(index, source));
+      path.push_back(vertexFromIndex(source.index(), source));
+
+      // changes the direction of the found path from destination->source
+      // to source->destination
+      for (int i = 0, j = path.size() - 1; i < j; i++, j--)
+      {
+         VertexT temp = path[i];
+         path[i] = path[j];
+         path[j] = temp;
+      }
+
+      return path; // returns a path from the source to the destination
+   }
 }
 #endif // GRAPH_H
@@ -0,0 +1,399 @@
+/***********************************************************************
+* Header:
+*    HASH
+* Summary:
+*    This class contains the notion of a hash table: a bucket of
+*    unique values found by way of a hash function. The hash function
+*    is either a Hasher given as a template parameter, which the
+*    compiler can inline into every probe, or by default a virtual
+*    hash() the user overrides in a class derived from Hash.
+*    Of particular interest is where the values live: right in the
+*    table, not in a list hanging off each bucket. A value that finds
+*    its slot taken goes to the next one along (linear probing), so a
+*    search reads neighbouring slots instead of chasing pointers. To
+*    keep those runs short, a value far from its home slot takes the
+*    slot of one that is closer to its own (Robin Hood hashing), and
+*    the table grows before it is three quarters full.
+*
+*    This will contain the class definition of:
+*       Hash <T, Hasher>       : a hash table of unique values
+*       HashFunction           : where a Hash gets its home slots
+*       hasher <T>             : hash functions for int, float and string
+* Author
+*    Daniel Perez, Jamie Hurd, Benjamin Dyas
+************************************************************************/
+#ifndef HASH_H
+#define HASH_H
+
+#include <cstring>      // for MEMCPY
+#include <new>          // for BAD_ALLOC
+#include <string>
+#include <string_view>
+
+// grow once the table would be fuller than this
+#define HASH_LOAD_PERCENT 75
+
+namespace custom
+{
+   /************************************************
+    * VIRTUAL HASH
+    * The Hasher that says the hash function is a
+    * virtual hash() of a class derived from Hash
+    ***********************************************/
+   struct VirtualHash {};
+
+   /************************************************
+    * HASH FUNCTION
+    * A Hasher returns a full unsigned hash of t. The
+    * capacity is kept a power of two, so the home
+    * slot is the low bits of it
+    ***********************************************/
+   template <class T, class Hasher>
+   class HashFunction
+   {
+   protected:
+      HashFunction() {}
+      HashFunction(const Hasher & hasher) : hasher(hasher) {}
+
+      int home(const T & t, int numCapacity) const
+      {
+         return (int)(hasher(t) & (unsigned int)(numCapacity - 1));
+      }
+      static int roundUp(int num)
+      {
+         int numRound = 1;
+         while (numRound < num)
+            numRound *= 2;
+         return (num == 0 ? 0 : numRound);
+      }
+
+   private:
+      Hasher hasher;
+   };
+
+   /************************************************
+    * HASH FUNCTION
+    * The old way: hash(t) must give a slot from 0
+    * to capacity() - 1, for whatever capacity() is
+    * at the time, and the capacity is left alone
+    ***********************************************/
+   template <class T>
+   class HashFunction <T, VirtualHash>
+   {
+   public:
+      virtual ~HashFunction() {}
+
+      // the slot t belongs in
+      virtual int hash(const T & t) const = 0;
+
+   protected:
+      HashFunction() {}
+      HashFunction(const VirtualHash &) {}
+
+      int home(const T & t, int /*numCapacity*/) const { return hash(t); }
+      static int roundUp(int num)                  { return num;     }
+   };
+
+   /************************************************
+    * HASH
+    * When the table grows every value is hashed
+    * again for the new capacity
+    ***********************************************/
+   template <class T, class Hasher = VirtualHash>
+   class Hash : public HashFunction <T, Hasher>
+   {
+   public:
+      // constructors, destructors
+      Hash(int numBuckets);
+      Hash(int numBuckets, const Hasher & hasher);
+      Hash(const Hash & rhs);
+      ~Hash() { delete [] slots; }
+
+      // overloaded operators
+      Hash & operator = (const Hash & rhs);
+
+      // container interfaces
+      int   size()      const { return numElements; }
+      int   capacity()  const { return numCapacity; }
+      bool  empty()     const { return numElements == 0; }
+      void  clear();
+
+      // hash specific
+      void  insert(const T & t);
+      bool  find(const T & t) const;
+
+   private:
+      // a value and how far it is from its home slot; -1 if empty
+      struct Slot
+      {
+         T value;
+         int distance;
+      };
+
+      Slot * slots;
+      int numElements;
+      int numCapacity;
+
+      Slot * allocate(int numCapacity);
+      void   grow();
+      void   place(const T & t);
+      int    next(int i) const { return (i + 1 == numCapacity ? 0 : i + 1); }
+   };
+
+   /**********************************************
+    * HASH : NON-DEFAULT CONSTRUCTOR
+    * numBuckets slots to start with, rounded up to
+    * a power of two if the Hasher needs it
+    **********************************************/
+   template <class T, class Hasher>
+   Hash<T, Hasher>::Hash(int numBuckets) :
+      slots(nullptr), numElements(0), numCapacity(0)
+   {
+      if (numBuckets < 0)
+         throw "ERROR: Unable to create a Hash with a negative number of buckets";
+      numBuckets = this->roundUp(numBuckets);
+      slots = allocate(numBuckets);
+      numCapacity = numBuckets;
+   }
+
+   template <class T, class Hasher>
+   Hash<T, Hasher>::Hash(int numBuckets, const Hasher & hasher) :
+      HashFunction <T, Hasher> (hasher), slots(nullptr), numElements(0), numCapacity(0)
+   {
+      if (numBuckets < 0)
+         throw "ERROR: Unable to create a Hash with a negative number of buckets";
+      numBuckets = this->roundUp(numBuckets);
+      slots = allocate(numBuckets);
+      numCapacity = numBuckets;
+   }
+
+   /**********************************************
+    * HASH : COPY CONSTRUCTOR
+    * The derived class is not built yet, so there
+    * may be no hash() to call: copy the slots as
+    * they are
+    **********************************************/
+   template <class T, class Hasher>
+   Hash<T, Hasher>::Hash(const Hash<T, Hasher> & rhs) :
+      HashFunction <T, Hasher> (rhs), slots(nullptr), numElements(0), numCapacity(0)
+   {
+      *this = rhs;
+   }
+
+   /**********************************************
+    * HASH : ASSIGNMENT OPERATOR
+    * The same capacity and the same layout as rhs
+    **********************************************/
+   template <class T, class Hasher>
+   Hash<T, Hasher> & Hash<T, Hasher>::operator = (const Hash<T, Hasher> & rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      Slot * slotsNew = allocate(rhs.numCapacity);
+      for (int i = 0; i < rhs.numCapacity; i++)
+         slotsNew[i] = rhs.slots[i];
+
+      delete [] slots;
+      slots = slotsNew;
+      HashFunction <T, Hasher> :: operator = (rhs);
+      numElements = rhs.numElements;
+      numCapacity = rhs.numCapacity;
+      return *this;
+   }
+
+   /**********************************************
+    * HASH : CLEAR
+    **********************************************/
+   template <class T, class Hasher>
+   void Hash<T, Hasher>::clear()
+   {
+      for (int i = 0; i < numCapacity; i++)
+         slots[i].distance = -1;
+      numElements = 0;
+   }
+
+   /**********************************************
+    * HASH : INSERT
+    * Nothing to do if t is already there
+    **********************************************/
+   template <class T, class Hasher>
+   void Hash<T, Hasher>::insert(const T & t)
+   {
+      if (find(t))
+         return;
+
+      if (100 * (numElements + 1) > HASH_LOAD_PERCENT * numCapacity)
+         grow();
+
+      place(t);
+      numElements++;
+   }
+
+   /**********************************************
+    * HASH : FIND
+    * Walk from the home slot. Every value is at
+    * least as far from home as the ones before it
+    * in the run, so once a slot is nearer its home
+    * than t would be, t is not there
+    **********************************************/
+   template <class T, class Hasher>
+   bool Hash<T, Hasher>::find(const T & t) const
+   {
+      if (numCapacity == 0)
+         return false;
+
+      int i = this->home(t, numCapacity);
+      for (int distance = 0; slots[i].distance >= distance; distance++)
+      {
+         if (slots[i].value == t)
+            return true;
+         i = next(i);
+      }
+      return false;
+   }
+
+   /**********************************************
+    * HASH : ALLOCATE
+    * Every slot starts out empty
+    **********************************************/
+   template <class T, class Hasher>
+   typename Hash<T, Hasher>::Slot * Hash<T, Hasher>::allocate(int numCapacity)
+   {
+      if (numCapacity == 0)
+         return nullptr;
+
+      Slot * slotsNew;
+      try
+      {
+         slotsNew = new Slot[numCapacity];
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: Unable to allocate a new buffer for Hash";
+      }
+
+      for (int i = 0; i < numCapacity; i++)
+         slotsNew[i].distance = -1;
+      return slotsNew;
+   }
+
+   /**********************************************
+    * HASH : GROW
+    * Twice the slots, which keeps a power of two
+    * one, and every value hashed again for the new
+    * capacity()
+    **********************************************/
+   template <class T, class Hasher>
+   void Hash<T, Hasher>::grow()
+   {
+      int numCapacityNew = (numCapacity == 0 ? 1 : numCapacity * 2);
+      while (100 * (numElements + 1) > HASH_LOAD_PERCENT * numCapacityNew)
+         numCapacityNew *= 2;
+
+      Slot * slotsOld = slots;
+      int numCapacityOld = numCapacity;
+      slots = allocate(numCapacityNew);
+      numCapacity = numCapacityNew;
+
+      for (int i = 0; i < numCapacityOld; i++)
+         if (slotsOld[i].distance != -1)
+            place(slotsOld[i].value);
+      delete [] slotsOld;
+   }
+
+   /**********************************************
+    * HASH : PLACE
+    * Walk from the home slot to an empty one. On
+    * the way, whenever the value in a slot is
+    * nearer its home than the one we carry, swap
+    * them and carry that one on instead
+    **********************************************/
+   template <class T, class Hasher>
+   void Hash<T, Hasher>::place(const T & t)
+   {
+      Slot carry;
+      carry.value = t;
+      carry.distance = 0;
+
+      int i = this->home(t, numCapacity);
+      while (slots[i].distance != -1)
+      {
+         if (slots[i].distance < carry.distance)
+         {
+            Slot tmp = slots[i];
+            slots[i] = carry;
+            carry = tmp;
+         }
+         i = next(i);
+         carry.distance++;
+      }
+      slots[i] = carry;
+   }
+/************************************************************ HASHERS ***/
+
+   /**********************************************
+    * MIX
+    * Spread every bit of h over every other, so
+    * the low bits a table keeps are as good as any
+    * (the last steps of MurmurHash3)
+    **********************************************/
+   inline unsigned int hashMix(unsigned int h)
+   {
+      h ^= h >> 16;
+      h *= 0x85ebca6bu;
+      h ^= h >> 13;
+      h *= 0xc2b2ae35u;
+      h ^= h >> 16;
+      return h;
+   }
+
+   /**********************************************
+    * HASHER
+    * Ready made Hashers: Hash <int, hasher <int> >
+    **********************************************/
+   template <class T>
+   struct hasher;
+
+   // one multiply spreads the low bits up, the shift brings the high
+   //    bits back down to where the mask keeps them
+   template <>
+   struct hasher <int>
+   {
+      unsigned int operator () (int t) const
+      {
+         unsigned int h = (unsigned int)t * 0x9e3779b1u;
+         return h ^ (h >> 16);
+      }
+   };
+
+   // the bits of the float: no divide. 0.0 and -0.0 are equal, so they
+   //    have to hash the same
+   template <>
+   struct hasher <float>
+   {
+      unsigned int operator () (float t) const
+      {
+         unsigned int bits = 0;
+         if (t != 0.0f)
+            std::memcpy(&bits, &t, sizeof(bits));
+         return hashMix(bits);
+      }
+   };
+
+   // FNV-1a over the characters. A string_view of the same characters
+   //    hashes the same, so it can look up a string without copying
+   template <>
+   struct hasher <std::string>
+   {
+      unsigned int operator () (std::string_view t) const
+      {
+         unsigned int h = 2166136261u;
+         for (unsigned char c : t)
+            h = (h ^ c) * 16777619u;
+         return hashMix(h);
+      }
+   };
+}; //end namespace custom
+
+#endif // HASH_H
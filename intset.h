@@ -0,0 +1,964 @@
+/***********************************************************************
+* Header:
+*    INTSET
+* Summary:
+*    This class contains the notion of a set of integers, such as the
+*    indices of a set of verticies, stored compressed.
+*    Of particular interest is how it is stored: the integers are cut
+*    in chunks of 65536 by their upper 16 bits. A chunk with few items
+*    keeps their lower 16 bits in a sorted array; a chunk with many
+*    keeps a bitmap of 65536 bits, which is smaller once it holds more
+*    than 4096 items. Union, intersection and difference work a whole
+*    chunk at a time, a bitmap one 64 bit word at a time.
+*
+*    This will contain the class definition of:
+*       intset              : a compressed set<int>
+*       intset :: iterator  : an iterator through the intset, in order
+* Author
+*    Daniel Perez, Benjamin Dyas
+************************************************************************/
+#ifndef INTSET_H
+#define INTSET_H
+
+#define INTSET_ARRAY_MAX   4096    // more items than this: a bitmap
+#define INTSET_CHUNK_BITS  65536   // integers per chunk
+#define INTSET_WORDS       (INTSET_CHUNK_BITS / 64)
+
+namespace custom
+{
+   /************************************************
+    * INTSET
+    * Container class that holds unique integers
+    * in chunks sorted by their upper 16 bits
+    ***********************************************/
+   class intset
+   {
+   private:
+      // 65536 consecutive integers. Exactly one of values and bits is
+      //    used, depending on how full the chunk is
+      struct Chunk
+      {
+         unsigned int key;          // the upper 16 bits
+         int numElements;
+         int numCapacity;           // of values
+         unsigned short * values;   // sorted lower 16 bits
+         unsigned long long * bits; // one bit per lower 16 bits
+      };
+
+   public:
+      // constructors & destructor
+      intset() : chunks{ nullptr }, numChunks{ 0 }, numCapacity{ 0 },
+                 numElements{ 0 } {}
+      intset(const intset & rhs);
+      ~intset() { clear(); }
+
+      // overloaded operators
+      intset & operator =  (const intset & rhs);
+      intset operator && (const intset & rhs) const;
+      intset operator || (const intset & rhs) const;
+      intset operator -  (const intset & rhs) const;
+
+      // standard container interfaces
+      int   size()      const { return numElements; }
+      bool  empty()     const { return (numElements == 0); }
+      void  clear();
+
+      // the various iterator interfaces. The integers are not stored
+      //    as they are, so they can only be read
+      class const_iterator;
+      typedef const_iterator iterator;
+      const_iterator begin()  const;
+      const_iterator end()    const;
+      const_iterator cbegin() const;
+      const_iterator cend()   const;
+
+      // set-specific interfaces
+      const_iterator find(int t) const;
+      void           insert(int t);
+      template <class Iterator>
+      void           insert(Iterator first, Iterator last)
+      {
+         for (Iterator it = first; it != last; ++it)
+            insert(*it);
+      }
+      const_iterator erase(const_iterator it);
+
+   private:
+      //member variables
+      Chunk ** chunks;   // sorted by key
+      int numChunks;
+      int numCapacity;   // of chunks
+      int numElements;
+
+      // integers are sorted as unsigned once the sign bit is flipped
+      static unsigned int toKey(int t)   { return ((unsigned int)t ^ 0x80000000u) >> 16; }
+      static unsigned int toLow(int t)   { return ((unsigned int)t ^ 0x80000000u) & 0xffff; }
+      static int toInt(unsigned int key, unsigned int low)
+      {
+         return (int)(((key << 16) | low) ^ 0x80000000u);
+      }
+
+      //member functions
+      int  findChunk(unsigned int key) const;
+      void insertChunk(int iChunk, Chunk * pChunk);
+      void eraseChunk(int iChunk);
+      void append(Chunk * pChunk);
+
+      // the chunks themselves
+      static Chunk * newArray(unsigned int key, int numCapacity);
+      static Chunk * newBitmap(unsigned int key);
+      static Chunk * copy(const Chunk * pChunk);
+      static void    destroy(Chunk * pChunk);
+      static bool    contains(const Chunk * pChunk, unsigned int low);
+      static int     lowerBound(const Chunk * pChunk, unsigned int low);
+      static bool    insert(Chunk * pChunk, unsigned int low);
+      static bool    erase(Chunk * pChunk, unsigned int low);
+      static void    toBitmap(Chunk * pChunk);
+      static void    toArray(Chunk * pChunk);
+      static Chunk * normalize(Chunk * pChunk);
+      static int     nextBit(const Chunk * pChunk, int bit);
+      static int     prevBit(const Chunk * pChunk, int bit);
+      static Chunk * intersect(const Chunk * pLhs, const Chunk * pRhs);
+      static Chunk * unite(const Chunk * pLhs, const Chunk * pRhs);
+      static Chunk * subtract(const Chunk * pLhs, const Chunk * pRhs);
+   }; // end class declaration
+
+/***************************************************** ITERATOR DEFINITION ***/
+
+   /**************************************************
+    * INTSET CONST_ITERATOR
+    * An iterator through the chunks. Within a chunk
+    * the position is an index in the array, or a
+    * bit of the bitmap
+    *************************************************/
+   class intset :: const_iterator
+   {
+   public:
+      // constructors, destructors, and assignment operator
+      const_iterator() : pSet(nullptr), iChunk(0), pos(0) {}
+      const_iterator(const intset * pSet, int iChunk, int pos) :
+         pSet(pSet), iChunk(iChunk), pos(pos) {}
+      const_iterator(const const_iterator & rhs) { *this = rhs; }
+
+      const_iterator & operator = (const const_iterator & rhs)
+      {
+         this->pSet = rhs.pSet;
+         this->iChunk = rhs.iChunk;
+         this->pos = rhs.pos;
+         return *this;
+      }
+
+      // equals, not equals operator
+      bool operator != (const const_iterator & rhs) const { return rhs.iChunk != this->iChunk || rhs.pos != this->pos; }
+      bool operator == (const const_iterator & rhs) const { return rhs.iChunk == this->iChunk && rhs.pos == this->pos; }
+
+      // dereference operator: the integer is rebuilt from its chunk
+      int operator * () const
+      {
+         const Chunk * pChunk = pSet->chunks[iChunk];
+         return toInt(pChunk->key, pChunk->bits ? pos : pChunk->values[pos]);
+      }
+
+      // prefix increment
+      const_iterator & operator ++ ()
+      {
+         const Chunk * pChunk = pSet->chunks[iChunk];
+         if (pChunk->bits != nullptr)
+            pos = nextBit(pChunk, pos + 1);
+         else
+            pos++;
+
+         // off the end of this chunk: the first one of the next
+         if (pos == (pChunk->bits ? INTSET_CHUNK_BITS : pChunk->numElements))
+         {
+            iChunk++;
+            pos = (iChunk == pSet->numChunks ? 0 : first(pSet->chunks[iChunk]));
+         }
+         return *this;
+      }
+
+      // postfix increment
+      const_iterator operator ++ (int postfix)
+      {
+         const_iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+      // prefix decrement
+      const_iterator & operator -- ()
+      {
+         int posPrev = -1;
+         if (iChunk < pSet->numChunks)
+         {
+            const Chunk * pChunk = pSet->chunks[iChunk];
+            posPrev = (pChunk->bits ? prevBit(pChunk, pos - 1) : pos - 1);
+         }
+
+         // before the start of this chunk: the last one of the previous
+         if (posPrev < 0)
+         {
+            const Chunk * pChunk = pSet->chunks[--iChunk];
+            posPrev = (pChunk->bits ? prevBit(pChunk, INTSET_CHUNK_BITS - 1) :
+                                      pChunk->numElements - 1);
+         }
+         pos = posPrev;
+         return *this;
+      }
+
+      // postfix decrement
+      const_iterator operator -- (int postfix)
+      {
+         const_iterator tmp(*this);
+         --(*this);
+         return tmp;
+      }
+
+      // where the first integer of a chunk is
+      static int first(const Chunk * pChunk)
+      {
+         return pChunk->bits ? nextBit(pChunk, 0) : 0;
+      }
+
+   private:
+      const intset * pSet;
+      int iChunk;
+      int pos;
+   };
+
+/************************************************** CONSTRUCTOR DEFINITION ***/
+
+   /*******************************************
+    * INTSET :: COPY CONSTRUCTOR
+    *******************************************/
+   inline intset :: intset(const intset & rhs) :
+      chunks{ nullptr }, numChunks{ 0 }, numCapacity{ 0 }, numElements{ 0 }
+   {
+      *this = rhs;
+   }
+
+/***************************************** OVERLOADED OPERATORS DEFINITION ***/
+
+   /********************************************
+    * INTSET : ASSIGNMENT OPERATOR OVERLOAD
+    ********************************************/
+   inline intset & intset :: operator = (const intset & rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      clear();
+      for (int i = 0; i < rhs.numChunks; i++)
+         append(copy(rhs.chunks[i]));
+      return *this;
+   }
+
+   /********************************************
+    * INTSET : INTERSECTION OPERATOR OVERLOAD
+    * RETURNS: A set by value with the values
+    *          found on both sets.
+    * PARAMETER: A set by reference
+    ********************************************/
+   inline intset intset :: operator && (const intset & rhs) const
+   {
+      intset setReturn;
+      int iLhs = 0;
+      int iRhs = 0;
+
+      // only the chunks found on both sides can have anything in common
+      while (iLhs < numChunks && iRhs < rhs.numChunks)
+      {
+         if (chunks[iLhs]->key < rhs.chunks[iRhs]->key)
+            iLhs++;
+         else if (rhs.chunks[iRhs]->key < chunks[iLhs]->key)
+            iRhs++;
+         else
+            setReturn.append(intersect(chunks[iLhs++], rhs.chunks[iRhs++]));
+      }
+
+      return setReturn;
+   }
+
+   /********************************************
+    * INTSET : UNION OPERATOR OVERLOAD
+    * RETURNS: A set by value with all the
+    *          items of both sets.
+    * PARAMETER: A set by reference
+    ********************************************/
+   inline intset intset :: operator || (const intset & rhs) const
+   {
+      intset setReturn;
+      int iLhs = 0;
+      int iRhs = 0;
+
+      // a chunk found on one side only is copied as it is
+      while (iLhs < numChunks || iRhs < rhs.numChunks)
+      {
+         if (iRhs == rhs.numChunks ||
+             (iLhs < numChunks && chunks[iLhs]->key < rhs.chunks[iRhs]->key))
+            setReturn.append(copy(chunks[iLhs++]));
+         else if (iLhs == numChunks || rhs.chunks[iRhs]->key < chunks[iLhs]->key)
+            setReturn.append(copy(rhs.chunks[iRhs++]));
+         else
+            setReturn.append(unite(chunks[iLhs++], rhs.chunks[iRhs++]));
+      }
+
+      return setReturn;
+   }
+
+   /********************************************
+    * INTSET : SUBTRACTION OPERATOR OVERLOAD
+    * RETURNS: the members that are in one set
+    *          but not in another. non-commutative
+    * PARAMETER: A set by reference.
+    ********************************************/
+   inline intset intset :: operator - (const intset & rhs) const
+   {
+      intset setReturn;
+      int iRhs = 0;
+
+      for (int iLhs = 0; iLhs < numChunks; iLhs++)
+      {
+         while (iRhs < rhs.numChunks && rhs.chunks[iRhs]->key < chunks[iLhs]->key)
+            iRhs++;
+
+         if (iRhs < rhs.numChunks && rhs.chunks[iRhs]->key == chunks[iLhs]->key)
+            setReturn.append(subtract(chunks[iLhs], rhs.chunks[iRhs]));
+         else
+            setReturn.append(copy(chunks[iLhs]));
+      }
+
+      return setReturn;
+   }
+
+/************************************** SET SPECIFIC INTERFACES DEFINITION ***/
+
+   /********************************************
+    * INTSET : CLEAR
+    * Release every chunk
+    *******************************************/
+   inline void intset :: clear()
+   {
+      for (int i = 0; i < numChunks; i++)
+         destroy(chunks[i]);
+      if (chunks != nullptr)
+         delete [] chunks;
+      chunks = nullptr;
+      numChunks = numCapacity = numElements = 0;
+   }
+
+   /********************************************
+    * INTSET : INSERT
+    * Insert an integer into the set. If already
+    * existent, do nothing.
+    *******************************************/
+   inline void intset :: insert(int t)
+   {
+      unsigned int key = toKey(t);
+      int iChunk = findChunk(key);
+      if (iChunk == numChunks || chunks[iChunk]->key != key)
+         insertChunk(iChunk, newArray(key, 4));
+
+      if (insert(chunks[iChunk], toLow(t)))
+         numElements++;
+   }
+
+   /********************************************
+    * INTSET : ERASE
+    * Erase an integer from the set. Returns the
+    * integer that followed it
+    *******************************************/
+   inline intset :: const_iterator intset :: erase(const_iterator it)
+   {
+      if (it == cend())
+         return it;
+
+      // chunks may change, so remember the next integer by value
+      int t = *it;
+      const_iterator itNext = it;
+      ++itNext;
+      bool hasNext = (itNext != cend());
+      int next = (hasNext ? *itNext : 0);
+
+      int iChunk = findChunk(toKey(t));
+      if (erase(chunks[iChunk], toLow(t)))
+      {
+         numElements--;
+         if (chunks[iChunk]->numElements == 0)
+            eraseChunk(iChunk);
+         else
+            chunks[iChunk] = normalize(chunks[iChunk]);
+      }
+
+      return hasNext ? find(next) : cend();
+   }
+
+/******************************************** PRIVATE FUNCTIONS DEFINITION ***/
+
+   /********************************************
+    * INTSET : FIND CHUNK
+    * The index of the first chunk whose key is
+    * not less than key
+    *******************************************/
+   inline int intset :: findChunk(unsigned int key) const
+   {
+      int indexBegin = 0;
+      int indexEnd = numChunks;
+      while (indexBegin < indexEnd)
+      {
+         int indexMiddle = (indexBegin + indexEnd) / 2;
+         if (chunks[indexMiddle]->key < key)
+            indexBegin = indexMiddle + 1;
+         else
+            indexEnd = indexMiddle;
+      }
+      return indexBegin;
+   }
+
+   /********************************************
+    * INTSET : INSERT CHUNK
+    * Put a chunk at iChunk, growing the list of
+    * chunks if needed
+    *******************************************/
+   inline void intset :: insertChunk(int iChunk, Chunk * pChunk)
+   {
+      if (numChunks == numCapacity)
+      {
+         int newCapacity = (numCapacity == 0 ? 1 : numCapacity * 2);
+         Chunk ** newChunks;
+         try
+         {
+            newChunks = new Chunk * [newCapacity];
+         }
+         catch (...)
+         {
+            throw "ERROR: Unable to allocate a new buffer for intset.";
+         }
+         for (int i = 0; i < numChunks; i++)
+            newChunks[i] = chunks[i];
+         if (chunks != nullptr)
+            delete [] chunks;
+         chunks = newChunks;
+         numCapacity = newCapacity;
+      }
+
+      for (int i = numChunks; i > iChunk; i--)
+         chunks[i] = chunks[i - 1];
+      chunks[iChunk] = pChunk;
+      numChunks++;
+   }
+
+   /********************************************
+    * INTSET : ERASE CHUNK
+    * Release an empty chunk
+    *******************************************/
+   inline void intset :: eraseChunk(int iChunk)
+   {
+      destroy(chunks[iChunk]);
+      for (int i = iChunk; i < numChunks - 1; i++)
+         chunks[i] = chunks[i + 1];
+      numChunks--;
+   }
+
+   /********************************************
+    * INTSET : APPEND
+    * Add a chunk after all the others. The set
+    * operators build their result this way, and
+    * an empty result chunk is simply dropped
+    *******************************************/
+   inline void intset :: append(Chunk * pChunk)
+   {
+      if (pChunk == nullptr)
+         return;
+      numElements += pChunk->numElements;
+      insertChunk(numChunks, pChunk);
+   }
+
+   /********************************************
+    * INTSET : NEW ARRAY
+    * An empty chunk of sorted values
+    *******************************************/
+   inline intset :: Chunk * intset :: newArray(unsigned int key, int numCapacity)
+   {
+      Chunk * pChunk = nullptr;
+      try
+      {
+         pChunk = new Chunk;
+         pChunk->values = new unsigned short[numCapacity];
+      }
+      catch (...)
+      {
+         delete pChunk;
+         throw "ERROR: Unable to allocate a new buffer for intset.";
+      }
+      pChunk->key = key;
+      pChunk->numElements = 0;
+      pChunk->numCapacity = numCapacity;
+      pChunk->bits = nullptr;
+      return pChunk;
+   }
+
+   /********************************************
+    * INTSET : NEW BITMAP
+    * An empty chunk of bits
+    *******************************************/
+   inline intset :: Chunk * intset :: newBitmap(unsigned int key)
+   {
+      Chunk * pChunk = nullptr;
+      try
+      {
+         pChunk = new Chunk;
+         pChunk->bits = new unsigned long long[INTSET_WORDS]();
+      }
+      catch (...)
+      {
+         delete pChunk;
+         throw "ERROR: Unable to allocate a new buffer for intset.";
+      }
+      pChunk->key = key;
+      pChunk->numElements = 0;
+      pChunk->numCapacity = 0;
+      pChunk->values = nullptr;
+      return pChunk;
+   }
+
+   /********************************************
+    * INTSET : COPY
+    * A chunk just like this one
+    *******************************************/
+   inline intset :: Chunk * intset :: copy(const Chunk * pChunk)
+   {
+      if (pChunk->bits != nullptr)
+      {
+         Chunk * pCopy = newBitmap(pChunk->key);
+         for (int i = 0; i < INTSET_WORDS; i++)
+            pCopy->bits[i] = pChunk->bits[i];
+         pCopy->numElements = pChunk->numElements;
+         return pCopy;
+      }
+
+      Chunk * pCopy = newArray(pChunk->key, pChunk->numElements);
+      for (int i = 0; i < pChunk->numElements; i++)
+         pCopy->values[i] = pChunk->values[i];
+      pCopy->numElements = pChunk->numElements;
+      return pCopy;
+   }
+
+   /********************************************
+    * INTSET : DESTROY
+    * Release a chunk
+    *******************************************/
+   inline void intset :: destroy(Chunk * pChunk)
+   {
+      delete [] pChunk->values;
+      delete [] pChunk->bits;
+      delete pChunk;
+   }
+
+   /********************************************
+    * INTSET : LOWER BOUND
+    * Where a value is, or should be, in an array
+    * chunk
+    *******************************************/
+   inline int intset :: lowerBound(const Chunk * pChunk, unsigned int low)
+   {
+      int indexBegin = 0;
+      int indexEnd = pChunk->numElements;
+      while (indexBegin < indexEnd)
+      {
+         int indexMiddle = (indexBegin + indexEnd) / 2;
+         if (pChunk->values[indexMiddle] < low)
+            indexBegin = indexMiddle + 1;
+         else
+            indexEnd = indexMiddle;
+      }
+      return indexBegin;
+   }
+
+   /********************************************
+    * INTSET : CONTAINS
+    * Is this value in the chunk?
+    *******************************************/
+   inline bool intset :: contains(const Chunk * pChunk, unsigned int low)
+   {
+      if (pChunk->bits != nullptr)
+         return (pChunk->bits[low >> 6] >> (low & 63)) & 1;
+
+      int i = lowerBound(pChunk, low);
+      return i < pChunk->numElements && pChunk->values[i] == low;
+   }
+
+   /********************************************
+    * INTSET : INSERT (CHUNK)
+    * Add a value to a chunk. A full array turns
+    * into a bitmap
+    *******************************************/
+   inline bool intset :: insert(Chunk * pChunk, unsigned int low)
+   {
+      if (pChunk->bits == nullptr)
+      {
+         int iInsert = lowerBound(pChunk, low);
+         if (iInsert < pChunk->numElements && pChunk->values[iInsert] == low)
+            return false;
+
+         if (pChunk->numElements < INTSET_ARRAY_MAX)
+         {
+            // grow the array the way a set does
+            if (pChunk->numElements == pChunk->numCapacity)
+            {
+               int newCapacity = pChunk->numCapacity * 2;
+               if (newCapacity > INTSET_ARRAY_MAX)
+                  newCapacity = INTSET_ARRAY_MAX;
+               unsigned short * newValues;
+               try
+               {
+                  newValues = new unsigned short[newCapacity];
+               }
+               catch (...)
+               {
+                  throw "ERROR: Unable to allocate a new buffer for intset.";
+               }
+               for (int i = 0; i < pChunk->numElements; i++)
+                  newValues[i] = pChunk->values[i];
+               delete [] pChunk->values;
+               pChunk->values = newValues;
+               pChunk->numCapacity = newCapacity;
+            }
+
+            for (int i = pChunk->numElements; i > iInsert; i--)
+               pChunk->values[i] = pChunk->values[i - 1];
+            pChunk->values[iInsert] = low;
+            pChunk->numElements++;
+            return true;
+         }
+
+         toBitmap(pChunk);
+      }
+
+      unsigned long long & word = pChunk->bits[low >> 6];
+      unsigned long long bit = 1ull << (low & 63);
+      if (word & bit)
+         return false;
+      word |= bit;
+      pChunk->numElements++;
+      return true;
+   }
+
+   /********************************************
+    * INTSET : ERASE (CHUNK)
+    * Take a value out of a chunk
+    *******************************************/
+   inline bool intset :: erase(Chunk * pChunk, unsigned int low)
+   {
+      if (pChunk->bits != nullptr)
+      {
+         unsigned long long & word = pChunk->bits[low >> 6];
+         unsigned long long bit = 1ull << (low & 63);
+         if (!(word & bit))
+            return false;
+         word &= ~bit;
+         pChunk->numElements--;
+         return true;
+      }
+
+      int iErase = lowerBound(pChunk, low);
+      if (iErase == pChunk->numElements || pChunk->values[iErase] != low)
+         return false;
+      for (int i = iErase; i < pChunk->numElements - 1; i++)
+         pChunk->values[i] = pChunk->values[i + 1];
+      pChunk->numElements--;
+      return true;
+   }
+
+   /********************************************
+    * INTSET : TO BITMAP
+    * Turn an array chunk into a bitmap chunk
+    *******************************************/
+   inline void intset :: toBitmap(Chunk * pChunk)
+   {
+      try
+      {
+         pChunk->bits = new unsigned long long[INTSET_WORDS]();
+      }
+      catch (...)
+      {
+         throw "ERROR: Unable to allocate a new buffer for intset.";
+      }
+      for (int i = 0; i < pChunk->numElements; i++)
+         pChunk->bits[pChunk->values[i] >> 6] |= 1ull << (pChunk->values[i] & 63);
+      delete [] pChunk->values;
+      pChunk->values = nullptr;
+      pChunk->numCapacity = 0;
+   }
+
+   /********************************************
+    * INTSET : TO ARRAY
+    * Turn a bitmap chunk into an array chunk
+    *******************************************/
+   inline void intset :: toArray(Chunk * pChunk)
+   {
+      try
+      {
+         pChunk->values = new unsigned short[pChunk->numElements > 0 ?
+                                             pChunk->numElements : 1];
+      }
+      catch (...)
+      {
+         throw "ERROR: Unable to allocate a new buffer for intset.";
+      }
+      int n = 0;
+      for (int i = 0; i < INTSET_WORDS; i++)
+         for (unsigned long long word = pChunk->bits[i]; word; word &= word - 1)
+            pChunk->values[n++] = (i << 6) + __builtin_ctzll(word);
+      pChunk->numCapacity = (n > 0 ? n : 1);
+      delete [] pChunk->bits;
+      pChunk->bits = nullptr;
+   }
+
+   /********************************************
+    * INTSET : NORMALIZE
+    * Give a chunk the smaller of the two forms.
+    * An empty chunk is released
+    *******************************************/
+   inline intset :: Chunk * intset :: normalize(Chunk * pChunk)
+   {
+      if (pChunk->numElements == 0)
+      {
+         destroy(pChunk);
+         return nullptr;
+      }
+      if (pChunk->bits != nullptr && pChunk->numElements <= INTSET_ARRAY_MAX)
+         toArray(pChunk);
+      return pChunk;
+   }
+
+   /********************************************
+    * INTSET : NEXT BIT
+    * The first bit at or after this one that is
+    * set, or INTSET_CHUNK_BITS if there is none
+    *******************************************/
+   inline int intset :: nextBit(const Chunk * pChunk, int bit)
+   {
+      if (bit >= INTSET_CHUNK_BITS)
+         return INTSET_CHUNK_BITS;
+
+      int i = bit >> 6;
+      unsigned long long word = pChunk->bits[i] & (~0ull << (bit & 63));
+      while (word == 0)
+      {
+         if (++i == INTSET_WORDS)
+            return INTSET_CHUNK_BITS;
+         word = pChunk->bits[i];
+      }
+      return (i << 6) + __builtin_ctzll(word);
+   }
+
+   /********************************************
+    * INTSET : PREV BIT
+    * The last bit at or before this one that is
+    * set, or -1 if there is none
+    *******************************************/
+   inline int intset :: prevBit(const Chunk * pChunk, int bit)
+   {
+      if (bit < 0)
+         return -1;
+
+      int i = bit >> 6;
+      unsigned long long word = pChunk->bits[i] & (~0ull >> (63 - (bit & 63)));
+      while (word == 0)
+      {
+         if (--i < 0)
+            return -1;
+         word = pChunk->bits[i];
+      }
+      return (i << 6) + 63 - __builtin_clzll(word);
+   }
+
+   /********************************************
+    * INTSET : INTERSECT
+    * The values in both chunks, or nullptr if
+    * there are none
+    *******************************************/
+   inline intset :: Chunk * intset :: intersect(const Chunk * pLhs, const Chunk * pRhs)
+   {
+      // two bitmaps: a word at a time
+      if (pLhs->bits != nullptr && pRhs->bits != nullptr)
+      {
+         Chunk * pChunk = newBitmap(pLhs->key);
+         for (int i = 0; i < INTSET_WORDS; i++)
+         {
+            pChunk->bits[i] = pLhs->bits[i] & pRhs->bits[i];
+            pChunk->numElements += __builtin_popcountll(pChunk->bits[i]);
+         }
+         return normalize(pChunk);
+      }
+
+      // an array and a bitmap: keep the values whose bit is set
+      if (pLhs->bits != nullptr || pRhs->bits != nullptr)
+      {
+         const Chunk * pArray  = (pLhs->bits == nullptr ? pLhs : pRhs);
+         const Chunk * pBitmap = (pLhs->bits == nullptr ? pRhs : pLhs);
+         Chunk * pChunk = newArray(pLhs->key, pArray->numElements);
+         for (int i = 0; i < pArray->numElements; i++)
+            if (contains(pBitmap, pArray->values[i]))
+               pChunk->values[pChunk->numElements++] = pArray->values[i];
+         return normalize(pChunk);
+      }
+
+      // two arrays: merge
+      Chunk * pChunk = newArray(pLhs->key, pLhs->numElements < pRhs->numElements ?
+                                           pLhs->numElements : pRhs->numElements);
+      int iLhs = 0;
+      int iRhs = 0;
+      while (iLhs < pLhs->numElements && iRhs < pRhs->numElements)
+      {
+         if (pLhs->values[iLhs] < pRhs->values[iRhs])
+            iLhs++;
+         else if (pRhs->values[iRhs] < pLhs->values[iLhs])
+            iRhs++;
+         else
+         {
+            pChunk->values[pChunk->numElements++] = pLhs->values[iLhs++];
+            iRhs++;
+         }
+      }
+      return normalize(pChunk);
+   }
+
+   /********************************************
+    * INTSET : UNITE
+    * The values in either chunk
+    *******************************************/
+   inline intset :: Chunk * intset :: unite(const Chunk * pLhs, const Chunk * pRhs)
+   {
+      // two small arrays: merge
+      if (pLhs->bits == nullptr && pRhs->bits == nullptr &&
+          pLhs->numElements + pRhs->numElements <= INTSET_ARRAY_MAX)
+      {
+         Chunk * pChunk = newArray(pLhs->key, pLhs->numElements + pRhs->numElements);
+         unsigned short * pReturn = pChunk->values;
+         int iLhs = 0;
+         int iRhs = 0;
+         while (iLhs < pLhs->numElements && iRhs < pRhs->numElements)
+         {
+            if (pLhs->values[iLhs] < pRhs->values[iRhs])
+               *pReturn++ = pLhs->values[iLhs++];
+            else if (pRhs->values[iRhs] < pLhs->values[iLhs])
+               *pReturn++ = pRhs->values[iRhs++];
+            else
+            {
+               *pReturn++ = pLhs->values[iLhs++];
+               iRhs++;
+            }
+         }
+         while (iLhs < pLhs->numElements)
+            *pReturn++ = pLhs->values[iLhs++];
+         while (iRhs < pRhs->numElements)
+            *pReturn++ = pRhs->values[iRhs++];
+         pChunk->numElements = pReturn - pChunk->values;
+         return normalize(pChunk);
+      }
+
+      // anything else: set the bits of both, then count them
+      Chunk * pChunk = newBitmap(pLhs->key);
+      const Chunk * sides[2] = { pLhs, pRhs };
+      for (int side = 0; side < 2; side++)
+      {
+         const Chunk * pSide = sides[side];
+         if (pSide->bits != nullptr)
+            for (int i = 0; i < INTSET_WORDS; i++)
+               pChunk->bits[i] |= pSide->bits[i];
+         else
+            for (int i = 0; i < pSide->numElements; i++)
+               pChunk->bits[pSide->values[i] >> 6] |= 1ull << (pSide->values[i] & 63);
+      }
+      for (int i = 0; i < INTSET_WORDS; i++)
+         pChunk->numElements += __builtin_popcountll(pChunk->bits[i]);
+      return normalize(pChunk);
+   }
+
+   /********************************************
+    * INTSET : SUBTRACT
+    * The values in the left chunk but not in the
+    * right one, or nullptr if there are none
+    *******************************************/
+   inline intset :: Chunk * intset :: subtract(const Chunk * pLhs, const Chunk * pRhs)
+   {
+      // an array: keep the values not on the right
+      if (pLhs->bits == nullptr)
+      {
+         Chunk * pChunk = newArray(pLhs->key, pLhs->numElements);
+         for (int i = 0; i < pLhs->numElements; i++)
+            if (!contains(pRhs, pLhs->values[i]))
+               pChunk->values[pChunk->numElements++] = pLhs->values[i];
+         return normalize(pChunk);
+      }
+
+      // a bitmap: clear the bits of the right
+      Chunk * pChunk = copy(pLhs);
+      if (pRhs->bits != nullptr)
+      {
+         pChunk->numElements = 0;
+         for (int i = 0; i < INTSET_WORDS; i++)
+         {
+            pChunk->bits[i] &= ~pRhs->bits[i];
+            pChunk->numElements += __builtin_popcountll(pChunk->bits[i]);
+         }
+      }
+      else
+         for (int i = 0; i < pRhs->numElements; i++)
+            erase(pChunk, pRhs->values[i]);
+      return normalize(pChunk);
+   }
+
+   /********************************************
+    * INTSET :: CBEGIN
+    ********************************************/
+   inline intset :: const_iterator intset :: cbegin() const
+   {
+      if (numChunks == 0)
+         return cend();
+      return const_iterator(this, 0, const_iterator::first(chunks[0]));
+   }
+
+   /********************************************
+    * INTSET :: CEND
+    ********************************************/
+   inline intset :: const_iterator intset :: cend() const
+   {
+      return const_iterator(this, numChunks, 0);
+   }
+
+   /********************************************
+    * INTSET :: BEGIN and END
+    * The same as cbegin() and cend()
+    ********************************************/
+   inline intset :: const_iterator intset :: begin() const { return cbegin(); }
+   inline intset :: const_iterator intset :: end()   const { return cend();   }
+
+   /********************************************
+    * INTSET : FIND
+    * Return an interator if an integer matches
+    * the search, otherwise return an interator
+    * to the end()
+    *******************************************/
+   inline intset :: const_iterator intset :: find(int t) const
+   {
+      unsigned int key = toKey(t);
+      unsigned int low = toLow(t);
+      int iChunk = findChunk(key);
+      if (iChunk == numChunks || chunks[iChunk]->key != key)
+         return cend();
+
+      const Chunk * pChunk = chunks[iChunk];
+      if (pChunk->bits != nullptr)
+         return contains(pChunk, low) ? const_iterator(this, iChunk, low) : cend();
+
+      int i = lowerBound(pChunk, low);
+      if (i < pChunk->numElements && pChunk->values[i] == low)
+         return const_iterator(this, iChunk, i);
+      return cend();
+   }
+}; //end namespace custom
+
+#endif // INTSET_H
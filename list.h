@@ -6,6 +6,10 @@
  *    it will declare and define a class that holds a linked list of
  *    nodes and all corresponding functions to manipulate it.
  *    Node and iterator nested classes will also be defined.
+ *    The nodes come from the Allocator, by default plain new and
+ *    delete, so any two lists can hand nodes to each other. A list that
+ *    adds and removes a lot can take a pool of slabs of its own
+ *    instead (see nodePool.h).
  *
  * Author
  *    Daniel Perez, Jamie Hurd, Benjamin Dyas
@@ -13,9 +17,13 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <cstddef>       // for NULL
+#include "nodePool.h"
+
 namespace custom
 {
-   template <class T> class list;
+   template <class T> class Node;
+   template <class T, class Allocator = newAllocator <Node <T> > > class list;
    /************************************************
     * CLASS NODE
     * Container class element that contains info
@@ -24,7 +32,8 @@ namespace custom
    template<class T>
    class Node{
 
-      friend class list<T>;
+      template <class U, class Allocator>
+      friend class list;
 
       public:
       //constructors
@@ -40,7 +49,7 @@ namespace custom
     * 
     * 
     ***********************************************/
-   template<class T>
+   template <class T, class Allocator>
    class list {
    private:
       //nested class
@@ -49,10 +58,21 @@ namespace custom
       Node<T> * pHead;
       Node<T> * pTail;
       int numElements;
+      Allocator allocator;    // where the nodes come from
+
+      //methods
+      Node<T> * newNode(const T & element);
+      void      deleteNode(Node<T> * pNode);
+      void      unlink(Node<T> * pFirst, Node<T> * pLast);
+      void      linkBefore(Node<T> * pPos, Node<T> * pFirst, Node<T> * pLast);
+      void      relink(Node<T> * pFirst);
+      static Node<T> * mergeRuns(Node<T> * pLeft, Node<T> * pRight);
 
    public:
       //constructors and destructor
       list() :pHead{ nullptr }, pTail{ nullptr }, numElements { 0 } {}
+      explicit list(const Allocator & allocator) :
+         pHead{ nullptr }, pTail{ nullptr }, numElements{ 0 }, allocator{ allocator } {}
       list(const list & rhs);
       ~list() {if(pHead != nullptr){clear();}}
       
@@ -94,6 +114,14 @@ namespace custom
       iterator  erase(iterator it);
       void      insert(iterator it, const T& t);
 
+      // list specific: these move nodes, they never copy elements. The
+      //    two lists' allocators must be able to share nodes
+      void      splice(iterator it, list & rhs);
+      void      splice(iterator it, list & rhs, iterator first);
+      void      splice(iterator it, list & rhs, iterator first, iterator last);
+      void      merge(list & rhs);
+      void      sort();
+
    };
 
    /********************************************
@@ -101,18 +129,14 @@ namespace custom
     * RETURNS:   ...
     * PARAMETER: ...
     ********************************************/
-   template <class T>
-   list<T> :: list(const list<T> & rhs)
+   template <class T, class Allocator>
+   list<T, Allocator> :: list(const list<T, Allocator> & rhs) :
+      pHead{ nullptr }, pTail{ nullptr }, numElements{ 0 }, allocator{ rhs.allocator }
    {
-      this->pHead = nullptr;
-      this->pTail = nullptr;
       for (Node<T> * p = rhs.pHead; p; p = p->pNext)
       {
          this->push_back(p->data);
       }
-
-      numElements = rhs.numElements;
-
    }
 
 /***************************************** OVERLOADED OPERATORS DEFINITION ***/
@@ -122,9 +146,14 @@ namespace custom
     * RETURNS:   ...
     * PARAMETER: ...
     ********************************************/
-   template <class T>
-   list<T> & list <T> :: operator = (const list <T> & rhs)
+   template <class T, class Allocator>
+   list<T, Allocator> & list <T, Allocator> :: operator = (const list <T, Allocator> & rhs)
    {
+      if (this == &rhs)
+      {
+         return *this;
+      }
+
       //clear the list before copying new information over
       this->clear();
 
@@ -147,12 +176,12 @@ namespace custom
     * An iterator through the internal array of 
     * the list
     *************************************************/
-   template <class T>
-   class list <T> :: iterator
+   template <class T, class Allocator>
+   class list <T, Allocator> :: iterator
    {
    public:
       //friend
-      friend class list<T>;
+      friend class list<T, Allocator>;
    
       // constructors, destructors, and assignment operator
       iterator() : p(NULL) {}
@@ -215,12 +244,12 @@ namespace custom
     * An iterator through the internal array of 
     * the list in reverse
     *************************************************/
-   template <class T>
-   class list <T> :: reverse_iterator
+   template <class T, class Allocator>
+   class list <T, Allocator> :: reverse_iterator
    {
    public:
       //friend
-      friend class list<T>;
+      friend class list<T, Allocator>;
    
       // constructors, destructors, and assignment operator
       reverse_iterator() : p(NULL) {}
@@ -282,8 +311,8 @@ namespace custom
     * DESCRIPTION:  clears the list
     * PARAMETER:    N/A
     ********************************************/
-   template <class T>
-   void list<T>::clear()
+   template <class T, class Allocator>
+   void list<T, Allocator>::clear()
    {  
       //while there are nodes still
       while(pHead != nullptr)
@@ -291,7 +320,7 @@ namespace custom
          //delete the node and update the head
          Node<T> * pDelete = pHead;
          pHead = pHead->pNext;
-         delete pDelete;
+         deleteNode(pDelete);
 
          //decrease size as it deletes
          --numElements;
@@ -308,22 +337,11 @@ namespace custom
    * DESCRIPTION: adds an element to the back
    * PARAMETER:   an element
    ********************************************/
-   template <class T>
-   void list<T> ::push_back(const T& element)
+   template <class T, class Allocator>
+   void list<T, Allocator> ::push_back(const T& element)
    {  
       //new node to be included
-      Node<T> * pNew = nullptr;
-
-      //try to allocate new node
-      try
-      {
-         pNew = new Node<T>(element);
-         
-      }
-      catch (std::bad_alloc)
-      {
-         std::cout <<  "ERROR: unable to allocate a new node for a list" << std::endl;
-      }
+      Node<T> * pNew = newNode(element);
 
       //if it's the first item to be pushed back
       if(pTail == nullptr && pHead == nullptr)
@@ -352,8 +370,8 @@ namespace custom
    * DESCRIPTION: adds an element to the front
    * PARAMETER:   an element
    ********************************************/
-   template <class T>
-   void list<T> ::push_front(const T& element)
+   template <class T, class Allocator>
+   void list<T, Allocator> ::push_front(const T& element)
    {  
       iterator it(pHead);
       insert(it, element);
@@ -364,12 +382,12 @@ namespace custom
    * DESCRIPTION: removes the back element
    * PARAMETER:   N/A
    ********************************************/
-   template <class T>
-   void list<T> ::pop_back()
+   template <class T, class Allocator>
+   void list<T, Allocator> ::pop_back()
    {  
       if (!empty())
       {
-         erase(this->back());
+         erase(iterator(pTail));
       }
 
    }
@@ -379,12 +397,12 @@ namespace custom
    * DESCRIPTION: removes the front element
    * PARAMETER:   N/A
    ********************************************/
-   template <class T>
-   void list<T> ::pop_front()
+   template <class T, class Allocator>
+   void list<T, Allocator> ::pop_front()
    {  
       if (!empty())
       {
-         erase(this->front());
+         erase(iterator(pHead));
       }
 
    }
@@ -394,8 +412,8 @@ namespace custom
    * RETURNS:   the back of the list
    * PARAMETER: N/A
    ********************************************/
-   template<class T>
-   T& list<T>::back()
+   template <class T, class Allocator>
+   T& list<T, Allocator>::back()
    {
       if (empty())
       {
@@ -413,8 +431,8 @@ namespace custom
    * RETURNS:    a const back of the list
    * PARAMETER: ...
    ********************************************/
-   template<class T>
-   const T list<T>::back() const
+   template <class T, class Allocator>
+   const T list<T, Allocator>::back() const
    {
       if (empty())
       {
@@ -432,8 +450,8 @@ namespace custom
    * RETURNS:   the front of the list
    * PARAMETER: ...
    ********************************************/
-   template<class T>
-   T& list<T>::front()
+   template <class T, class Allocator>
+   T& list<T, Allocator>::front()
    {
       if (empty())
       {
@@ -451,8 +469,8 @@ namespace custom
    * RETURNS:   a const front of the list
    * PARAMETER: ...
    ********************************************/
-   template<class T>
-   const T list<T>::front() const
+   template <class T, class Allocator>
+   const T list<T, Allocator>::front() const
    {
       if (empty())
       {
@@ -470,8 +488,8 @@ namespace custom
     * DESCRIPTION: searches for a value
     * PARAMETER:   receives an element to find
     ********************************************/
-   template <class T>
-   typename list<T>::iterator list<T>::find(const T & element)
+   template <class T, class Allocator>
+   typename list<T, Allocator>::iterator list<T, Allocator>::find(const T & element)
    {
       //Loop to traverse the linked list
       for(Node<T> * p = pHead; p; p = p->pNext)
@@ -492,8 +510,8 @@ namespace custom
     * DESCRIPTION:  removes the requested item
     * PARAMETER:    an iterator
     ********************************************/
-   template <class T>
-   typename list<T>::iterator list<T>::erase(list<T>::iterator it)
+   template <class T, class Allocator>
+   typename list<T, Allocator>::iterator list<T, Allocator>::erase(list<T, Allocator>::iterator it)
    {
    
      Node<T> * pRemove;
@@ -511,6 +529,12 @@ namespace custom
          pHead = pRemove->pNext;
       }
 
+      //the last one out, even if it was also the first
+      if (pRemove == pTail)
+      {
+         pTail = pRemove->pPrev;
+      }
+
       //if it's not the first element (pPrev != null)
       if (pRemove->pPrev)
       {
@@ -545,7 +569,7 @@ namespace custom
       }
 
       //the actual deletion of the now orphaned node
-      delete pRemove;
+      deleteNode(pRemove);
 
       numElements--;
 
@@ -557,10 +581,10 @@ namespace custom
     * DESCRIPTION:  inserts a value into the list 
     * PARAMETER:    an iterator and data
     ********************************************/
-   template <class T>
-   void list<T>::insert(iterator it, const T& t)
+   template <class T, class Allocator>
+   void list<T, Allocator>::insert(iterator it, const T& t)
    {
-      Node<T> * pNew = new Node<T>(t);
+      Node<T> * pNew = newNode(t);
       iterator nullIt(nullptr);
 
       //If it's null
@@ -596,6 +620,335 @@ namespace custom
    
 
 
+   /********************************************
+    * FUNCTION:     SPLICE
+    * DESCRIPTION:  moves all of rhs in front of it
+    * PARAMETER:    where to, and the list to empty
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::splice(iterator it, list<T, Allocator> & rhs)
+   {
+      splice(it, rhs, rhs.begin(), rhs.end());
+   }
+
+   /********************************************
+    * FUNCTION:     SPLICE
+    * DESCRIPTION:  moves the one element at first
+    *               in front of it
+    * PARAMETER:    where to, where from
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::splice(iterator it, list<T, Allocator> & rhs, iterator first)
+   {
+      if (first.p != nullptr)
+      {
+         splice(it, rhs, first, iterator(first.p->pNext));
+      }
+   }
+
+   /********************************************
+    * FUNCTION:     SPLICE
+    * DESCRIPTION:  moves [first, last) in front of
+    *               it by relinking the two ends.
+    *               Within one list, or for all of
+    *               rhs, or for one element, that is
+    *               constant time. Any other range
+    *               from another list has to be
+    *               counted to keep both sizes right.
+    *               Nodes from an allocator that this
+    *               one cannot give back to (another
+    *               nodePool) cannot move
+    * PARAMETER:    where to, where from
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::splice(iterator it, list<T, Allocator> & rhs,
+                                   iterator first, iterator last)
+   {
+      //nothing to move, or it is already there
+      if (first == last || it == first)
+      {
+         return;
+      }
+      if (allocator != rhs.allocator)
+      {
+         throw "ERROR: Unable to splice nodes from a list with another allocator";
+      }
+
+      Node<T> * pFirst = first.p;
+      Node<T> * pLast = (last.p == nullptr ? rhs.pTail : last.p->pPrev);
+
+      //how many are moving
+      int num = 1;
+      if (&rhs != this)
+      {
+         if (pFirst == rhs.pHead && pLast == rhs.pTail)
+         {
+            num = rhs.numElements;
+         }
+         else
+         {
+            for (Node<T> * p = pFirst; p != pLast; p = p->pNext)
+            {
+               num++;
+            }
+         }
+      }
+
+      rhs.unlink(pFirst, pLast);
+      rhs.numElements -= (&rhs != this ? num : 0);
+
+      linkBefore(it.p, pFirst, pLast);
+      numElements += (&rhs != this ? num : 0);
+   }
+
+   /********************************************
+    * FUNCTION:     MERGE
+    * DESCRIPTION:  moves the elements of rhs into
+    *               this, both sorted, keeping it
+    *               sorted. Equal elements of this
+    *               stay in front of those of rhs
+    * PARAMETER:    the list to empty
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::merge(list<T, Allocator> & rhs)
+   {
+      if (&rhs == this || rhs.empty())
+      {
+         return;
+      }
+
+      //put rhs on the end, then merge the two runs
+      Node<T> * pLeftTail = pTail;
+      splice(end(), rhs);
+      if (pLeftTail == nullptr)
+      {
+         return;
+      }
+
+      Node<T> * pRight = pLeftTail->pNext;
+      pLeftTail->pNext = nullptr;
+      relink(mergeRuns(pHead, pRight));
+   }
+
+   /********************************************
+    * FUNCTION:     SORT
+    * DESCRIPTION:  a stable bottom up merge sort
+    *               that relinks the nodes. Bin i
+    *               holds a sorted run of 2^i nodes:
+    *               each node is a run of one that
+    *               carries up through the full bins
+    *               like adding one to a binary
+    *               counter. Nothing is allocated and
+    *               every iterator stays valid
+    * PARAMETER:    N/A
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::sort()
+   {
+      if (numElements < 2)
+      {
+         return;
+      }
+
+      Node<T> * bins[sizeof(int) * 8 + 1] = {};
+      int numBins = 0;
+
+      //the runs only use pNext until the end
+      Node<T> * p = pHead;
+      while (p != nullptr)
+      {
+         Node<T> * pRun = p;
+         p = p->pNext;
+         pRun->pNext = nullptr;
+
+         //what is already in a bin came first, so it goes on the left
+         int i = 0;
+         for (; i < numBins && bins[i] != nullptr; i++)
+         {
+            pRun = mergeRuns(bins[i], pRun);
+            bins[i] = nullptr;
+         }
+         bins[i] = pRun;
+         if (i == numBins)
+         {
+            numBins++;
+         }
+      }
+
+      //the higher bins hold the earlier nodes
+      Node<T> * pSorted = nullptr;
+      for (int i = 0; i < numBins; i++)
+      {
+         if (bins[i] != nullptr)
+         {
+            pSorted = (pSorted == nullptr ? bins[i] : mergeRuns(bins[i], pSorted));
+         }
+      }
+      relink(pSorted);
+   }
+
+   /********************************************
+    * FUNCTION:     UNLINK
+    * DESCRIPTION:  takes the nodes pFirst to pLast
+    *               out of the list, leaving the
+    *               size for the caller to fix
+    * PARAMETER:    the first and last nodes
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::unlink(Node<T> * pFirst, Node<T> * pLast)
+   {
+      if (pFirst->pPrev)
+      {
+         pFirst->pPrev->pNext = pLast->pNext;
+      }
+      else
+      {
+         pHead = pLast->pNext;
+      }
+
+      if (pLast->pNext)
+      {
+         pLast->pNext->pPrev = pFirst->pPrev;
+      }
+      else
+      {
+         pTail = pFirst->pPrev;
+      }
+
+      pFirst->pPrev = nullptr;
+      pLast->pNext = nullptr;
+   }
+
+   /********************************************
+    * FUNCTION:     LINK BEFORE
+    * DESCRIPTION:  puts the nodes pFirst to pLast
+    *               in front of pPos, or on the end
+    *               if pPos is null
+    * PARAMETER:    where, the first and last nodes
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::linkBefore(Node<T> * pPos, Node<T> * pFirst, Node<T> * pLast)
+   {
+      Node<T> * pBefore = (pPos ? pPos->pPrev : pTail);
+
+      pFirst->pPrev = pBefore;
+      pLast->pNext = pPos;
+
+      if (pBefore)
+      {
+         pBefore->pNext = pFirst;
+      }
+      else
+      {
+         pHead = pFirst;
+      }
+
+      if (pPos)
+      {
+         pPos->pPrev = pLast;
+      }
+      else
+      {
+         pTail = pLast;
+      }
+   }
+
+   /********************************************
+    * FUNCTION:     RELINK
+    * DESCRIPTION:  the nodes are chained by pNext
+    *               only: set every pPrev, the head
+    *               and the tail
+    * PARAMETER:    the first node
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::relink(Node<T> * pFirst)
+   {
+      Node<T> * pPrev = nullptr;
+      for (Node<T> * p = pFirst; p != nullptr; p = p->pNext)
+      {
+         p->pPrev = pPrev;
+         pPrev = p;
+      }
+      pHead = pFirst;
+      pTail = pPrev;
+   }
+
+   /********************************************
+    * FUNCTION:     MERGE RUNS
+    * DESCRIPTION:  merges two sorted chains linked
+    *               by pNext. On a tie the left one
+    *               goes first, which keeps it stable
+    * PARAMETER:    the two chains
+    ********************************************/
+   template <class T, class Allocator>
+   Node<T> * list<T, Allocator>::mergeRuns(Node<T> * pLeft, Node<T> * pRight)
+   {
+      Node<T> * pFirst = nullptr;
+      Node<T> ** ppNext = &pFirst;
+
+      while (pLeft != nullptr && pRight != nullptr)
+      {
+         if (pRight->data < pLeft->data)
+         {
+            *ppNext = pRight;
+            pRight = pRight->pNext;
+         }
+         else
+         {
+            *ppNext = pLeft;
+            pLeft = pLeft->pNext;
+         }
+         ppNext = &(*ppNext)->pNext;
+      }
+
+      *ppNext = (pLeft != nullptr ? pLeft : pRight);
+      return pFirst;
+   }
+
+   /********************************************
+    * FUNCTION:     NEW NODE
+    * DESCRIPTION:  builds a node where the allocator
+    *               says, giving the room back if
+    *               copying the element throws
+    * PARAMETER:    the element to copy into it
+    ********************************************/
+   template <class T, class Allocator>
+   Node<T> * list<T, Allocator>::newNode(const T & element)
+   {
+      void * pRoom;
+      try
+      {
+         pRoom = allocator.allocate();
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: unable to allocate a new node for a list";
+      }
+
+      try
+      {
+         return new (pRoom) Node<T>(element);
+      }
+      catch (...)
+      {
+         allocator.deallocate(pRoom);
+         throw;
+      }
+   }
+
+   /********************************************
+    * FUNCTION:     DELETE NODE
+    * DESCRIPTION:  destroys a node and gives its
+    *               room back to the allocator
+    * PARAMETER:    the node
+    ********************************************/
+   template <class T, class Allocator>
+   void list<T, Allocator>::deleteNode(Node<T> * pNode)
+   {
+      pNode->~Node<T>();
+      allocator.deallocate(pNode);
+   }
+
 /*********************************************CONST_REVERSE_ITERATOR DEFINITION ***/
 
    /**************************************************
@@ -603,12 +956,12 @@ namespace custom
     * An iterator through the internal array of 
     * the list
     *************************************************/
-   template <class T>
-   class list <T> :: const_reverse_iterator
+   template <class T, class Allocator>
+   class list <T, Allocator> :: const_reverse_iterator
    {
    public:
       //friend
-      friend class list<T>;
+      friend class list<T, Allocator>;
    
       // constructors, destructors, and assignment operator
       const_reverse_iterator() : p(NULL) {}
@@ -671,12 +1024,12 @@ namespace custom
     * An iterator through the internal array of 
     * the list
     *************************************************/
-   template <class T>
-   class list <T> :: const_iterator
+   template <class T, class Allocator>
+   class list <T, Allocator> :: const_iterator
    {
    public:
       //friend
-      friend class list<T>;
+      friend class list<T, Allocator>;
    
       // constructors, destructors, and assignment operator
       const_iterator() : p(NULL) {}
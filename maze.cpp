@@ -16,7 +16,6 @@
 #include <fstream>
 #include <string>
 #include <cassert>
-#include <cmath>
 #include "maze.h"
 #include "vertex.h"
 #include "graph.h"
@@ -43,8 +42,8 @@ void drawMazeRow(const Graph & g, int row, set <CVertex> & s)
 {
    const char * space = NULL;
    
-   CVertex vFrom;
-   CVertex vTo;
+   CVertex vFrom(g.getDomain());
+   CVertex vTo(g.getDomain());
    assert(g.size() == vFrom.getMaxCol() * vFrom.getMaxRow());
 
 
@@ -79,8 +78,8 @@ void drawMazeRow(const Graph & g, int row, set <CVertex> & s)
  *********************************************/
 void drawMazeColumn(const Graph & g, int row, const set <CVertex> & s)
 {
-   CVertex vFrom;
-   CVertex vTo;
+   CVertex vFrom(g.getDomain());
+   CVertex vTo(g.getDomain());
    assert(g.size() == vFrom.getMaxCol() * vFrom.getMaxRow());
 
    // they all start with a #
@@ -114,7 +113,7 @@ void drawMazeColumn(const Graph & g, int row, const set <CVertex> & s)
  ***********************************************/
 void drawMaze(const Graph & g, const vector <Vertex> & path)
 {
-   CVertex v;
+   CVertex v(g.getDomain());
 
    // copy everything into a set
    set <CVertex> s;
@@ -162,12 +161,13 @@ custom :: Graph readMaze(const char * fileName)
    int numCol;
    int numRow;
    fin >> numCol >> numRow;
-   CVertex vFrom;
-   CVertex vTo;
-   vFrom.setMax(numCol, numRow);
+   VertexDomain domain;
+   domain.setMax(numCol, numRow);
 
    // now read all the items and put them into the Graph
-   Graph g(vFrom.getMax());
+   Graph g(domain);
+   CVertex vFrom(domain);
+   CVertex vTo(domain);
    while (fin >> vFrom >> vTo)
       g.add(vFrom, vTo);
 
@@ -197,15 +197,17 @@ void solveMaze()
    //Graph g = readMaze("/mnt/c/00cs235/maze5x5.txt");
 
    //Vertices
-   CVertex source;
-   CVertex destination;
+   CVertex source(g.getDomain());
+   CVertex destination(g.getDomain());
 
-   //find the destination: right-most, lowest
-   char end = 96 + sqrt(g.size());
-   int num = sqrt(g.size());
-   string end1(1, end);
-   destination.setText( end1 + std::to_string(num) );
-   source.setText("a1");   
+   //the source is the left-most, highest. If the grid has no columns,
+   //   readMaze() already reported why
+   if (!source.set(0, 0))
+      return;
+
+   //find the destination: right-most, lowest. The maze does not
+   //   need to be square, so use both of its dimensions
+   destination.set(destination.getMaxCol() - 1, destination.getMaxRow() - 1);
 
    //Vector to hold solution   
    vector<Vertex> v;
@@ -221,6 +223,14 @@ void solveMaze()
    //Find Maze solution
    v = g.findPath(source, destination);
 
+   //an empty path means the destination is unreachable
+   if (v.empty())
+   {
+      cout << "There is no path from " << source << " to "
+           << destination << ".\n";
+      return;
+   }
+
    //Draw maze with solution
    drawMaze(g, v);
 }
\ No newline at end of file
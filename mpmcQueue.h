@@ -0,0 +1,284 @@
+/***********************************************************************
+* Header:
+*    MPMC QUEUE
+* Summary:
+*    This class contains the notion of a queue shared by any number of
+*    threads pushing and any number of threads popping, such as jobs
+*    going to a pool of worker threads.
+*    Of particular interest is the sequence number in every slot: it
+*    says whether the slot is waiting for a push or for a pop, and in
+*    which lap around the ring buffer. A thread claims a slot by moving
+*    the head or the tail on with one compare and swap, fills or empties
+*    it, then sets the sequence number to hand it on. No lock is taken.
+*
+*    This will contain the class definition of:
+*       mpmcQueue              : a bounded multiple producer, multiple
+*                                consumer queue
+* Author
+*    Benjamin Dyas, Daniel Perez
+************************************************************************/
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <new>          // for BAD_ALLOC
+#include <thread>       // for YIELD
+#include <utility>      // for MOVE
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+// how many times a blocking push or pop tries again before it gives the
+//    processor to another thread
+#define MPMC_SPIN_LIMIT 64
+
+namespace custom
+{
+   /************************************************
+    * MPMC QUEUE
+    * A fixed size ring buffer any thread may push
+    * onto or pop from. There is no front(): between
+    * looking at the front and popping it another
+    * thread may pop it, so pop() hands the item back
+    ***********************************************/
+   template <class T>
+   class mpmcQueue
+   {
+   public:
+      // constructors, destructors
+      explicit mpmcQueue(int numCapacity);
+      mpmcQueue(const mpmcQueue & rhs) = delete;
+      mpmcQueue & operator = (const mpmcQueue & rhs) = delete;
+      ~mpmcQueue() { delete [] cells; }
+
+      // container interfaces. Other threads may change the size at
+      //    any moment, so it is only a snapshot
+      int   size()      const;
+      int   capacity()  const { return (int)(mask + 1); }
+      bool  empty()     const { return size() == 0; }
+
+      // wait for room, or for an item
+      void  push(const T & element);
+      void  push(T && element);
+      void  pop(T & element);
+
+      // never wait: false when the queue is full, or empty
+      bool  tryPush(const T & element);
+      bool  tryPush(T && element);
+      bool  tryPop(T & element);
+
+   private:
+      // a slot holds an item once its sequence is one past its position
+      struct Cell
+      {
+         std::atomic <unsigned int> sequence;
+         T data;
+      };
+
+      // read only once built
+      Cell * cells;
+      unsigned int mask;        // the capacity, a power of two, minus one
+
+      // the producers and the consumers each have their own line
+      alignas(CACHE_LINE_SIZE) std::atomic <unsigned int> tail;
+      alignas(CACHE_LINE_SIZE) std::atomic <unsigned int> head;
+      char padding[CACHE_LINE_SIZE - sizeof(std::atomic <unsigned int>)];
+
+      Cell * claimPush();
+      Cell * claimPop(unsigned int & pos);
+      static void backOff(int & numTries);
+   };
+
+   /**********************************************
+    * MPMC QUEUE : NON-DEFAULT CONSTRUCTOR
+    * Allocate the array to "numCapacity", rounded
+    * up to a power of two of at least two. Slot i
+    * starts out waiting for push number i
+    **********************************************/
+   template <class T>
+   mpmcQueue<T>::mpmcQueue(int numCapacity) :
+      cells(nullptr), mask(0), tail(0), head(0)
+   {
+      unsigned int capacity = 2;
+      while ((int)capacity < numCapacity)
+         capacity *= 2;
+
+      try
+      {
+         cells = new Cell[capacity];
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: Unable to allocate a new buffer for mpmcQueue";
+      }
+
+      for (unsigned int i = 0; i < capacity; i++)
+         cells[i].sequence.store(i, std::memory_order_relaxed);
+      mask = capacity - 1;
+   }
+
+   /**********************************************
+    * MPMC QUEUE : SIZE
+    **********************************************/
+   template <class T>
+   int mpmcQueue<T>::size() const
+   {
+      int num = (int)(tail.load(std::memory_order_acquire) -
+                      head.load(std::memory_order_acquire));
+      return (num < 0 ? 0 : (num > capacity() ? capacity() : num));
+   }
+
+   /**********************************************
+    * MPMC QUEUE : PUSH
+    * Try again until there is room
+    **********************************************/
+   template <class T>
+   void mpmcQueue<T>::push(const T & element)
+   {
+      int numTries = 0;
+      while (!tryPush(element))
+         backOff(numTries);
+   }
+
+   template <class T>
+   void mpmcQueue<T>::push(T && element)
+   {
+      int numTries = 0;
+      while (!tryPush(std::move(element)))
+         backOff(numTries);
+   }
+
+   /**********************************************
+    * MPMC QUEUE : POP
+    * Try again until there is an item
+    **********************************************/
+   template <class T>
+   void mpmcQueue<T>::pop(T & element)
+   {
+      int numTries = 0;
+      while (!tryPop(element))
+         backOff(numTries);
+   }
+
+   /**********************************************
+    * MPMC QUEUE : TRY PUSH
+    * Claim the slot at the tail, fill it, then
+    * mark it ready to be popped
+    **********************************************/
+   template <class T>
+   bool mpmcQueue<T>::tryPush(const T & element)
+   {
+      Cell * pCell = claimPush();
+      if (pCell == nullptr)
+         return false;
+
+      unsigned int pos = pCell->sequence.load(std::memory_order_relaxed);
+      pCell->data = element;
+      pCell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+   }
+
+   template <class T>
+   bool mpmcQueue<T>::tryPush(T && element)
+   {
+      Cell * pCell = claimPush();
+      if (pCell == nullptr)
+         return false;
+
+      unsigned int pos = pCell->sequence.load(std::memory_order_relaxed);
+      pCell->data = std::move(element);
+      pCell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+   }
+
+   /**********************************************
+    * MPMC QUEUE : TRY POP
+    * Claim the slot at the head, empty it, then
+    * mark it ready for the push one lap later
+    **********************************************/
+   template <class T>
+   bool mpmcQueue<T>::tryPop(T & element)
+   {
+      unsigned int pos;
+      Cell * pCell = claimPop(pos);
+      if (pCell == nullptr)
+         return false;
+
+      element = std::move(pCell->data);
+      pCell->sequence.store(pos + mask + 1, std::memory_order_release);
+      return true;
+   }
+
+   /**********************************************
+    * MPMC QUEUE : CLAIM PUSH
+    * The slot at the tail is free once its
+    * sequence is the tail. If it is behind, the
+    * slot still holds an item from the lap before:
+    * the queue is full. If it is ahead, another
+    * producer got there first: look again
+    **********************************************/
+   template <class T>
+   typename mpmcQueue<T>::Cell * mpmcQueue<T>::claimPush()
+   {
+      unsigned int pos = tail.load(std::memory_order_relaxed);
+      for (;;)
+      {
+         Cell * pCell = cells + (pos & mask);
+         int diff = (int)(pCell->sequence.load(std::memory_order_acquire) - pos);
+         if (diff == 0)
+         {
+            if (tail.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed))
+               return pCell;
+         }
+         else if (diff < 0)
+            return nullptr;
+         else
+            pos = tail.load(std::memory_order_relaxed);
+      }
+   }
+
+   /**********************************************
+    * MPMC QUEUE : CLAIM POP
+    * The same at the head: the slot holds an item
+    * once its sequence is one past the head
+    **********************************************/
+   template <class T>
+   typename mpmcQueue<T>::Cell * mpmcQueue<T>::claimPop(unsigned int & pos)
+   {
+      pos = head.load(std::memory_order_relaxed);
+      for (;;)
+      {
+         Cell * pCell = cells + (pos & mask);
+         int diff = (int)(pCell->sequence.load(std::memory_order_acquire) - (pos + 1));
+         if (diff == 0)
+         {
+            if (head.compare_exchange_weak(pos, pos + 1,
+                                           std::memory_order_relaxed))
+               return pCell;
+         }
+         else if (diff < 0)
+            return nullptr;
+         else
+            pos = head.load(std::memory_order_relaxed);
+      }
+   }
+
+   /**********************************************
+    * MPMC QUEUE : BACK OFF
+    * Spin a while, as the other side is probably
+    * about to finish, then let it have the processor
+    **********************************************/
+   template <class T>
+   void mpmcQueue<T>::backOff(int & numTries)
+   {
+      if (++numTries >= MPMC_SPIN_LIMIT)
+      {
+         std::this_thread::yield();
+         numTries = 0;
+      }
+   }
+}; //end namespace custom
+
+#endif // MPMC_QUEUE_H
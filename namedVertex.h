@@ -0,0 +1,327 @@
+/***********************************************************************
+* Header:
+*    NAMED VERTEX
+* Summary:
+*    This class contains the notion of a name table: every distinct
+*    label seen gets the next index, so a graph of arbitrary names can
+*    be stored as a graph of small integers.
+*    Of particular interest is where the labels live: they are copied
+*    back to back into large blocks (an arena) instead of one string
+*    each, and found again through an open addressing hash table.
+*
+*    This will contain the class definition of:
+*       NameTable           : interns labels to dense indices
+*       NamedVertex         : a vertex whose text comes from a name table
+*       readEdges()         : load a list of edges into a graph
+* Author
+*    Daniel Perez, Jamie Hurd, Benjamin Dyas
+************************************************************************/
+#ifndef NAMED_VERTEX_H
+#define NAMED_VERTEX_H
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include "vertex.h"
+#include "vector.h"
+#include "graph.h"
+
+#define NAME_BLOCK_SIZE 65536   // bytes of labels per arena block
+
+/************************************************
+ * NAME TABLE
+ * Every label gets an index the first time it is
+ * interned and keeps it for as long as the table
+ * lives. The text handed back points into the arena,
+ * so it never moves
+ ***********************************************/
+class NameTable
+{
+public:
+   NameTable() : numSlots(0), filling(nullptr), blockUsed(0) {}
+   NameTable(const NameTable & rhs) = delete;
+   NameTable & operator = (const NameTable & rhs) = delete;
+   ~NameTable()
+   {
+      for (int i = 0; i < blocks.size(); i++)
+         delete [] blocks[i];
+   }
+
+   // standard container interfaces
+   int  size()  const { return labels.size();  }
+   bool empty() const { return labels.empty(); }
+
+   // the bounds of the verticies named so far
+   VertexDomain getDomain() const { return VertexDomain(empty() ? 1 : size()); }
+
+   // the index of a label, adding it if it was never seen
+   int intern(std::string_view s);
+
+   // the index of a label, or -1 if it was never seen
+   int find(std::string_view s) const
+   {
+      return numSlots == 0 ? -1 :
+             slots[findSlot(s, labelHash(s.data(), s.size(), 0))].index;
+   }
+
+   // the text of a label: 0 --> the first label interned
+   std::string_view nameFromIndex(int i) const
+   {
+      assert(i >= 0 && i < size());
+      return std::string_view(labels[i].text, labels[i].length);
+   }
+
+private:
+   // where a label lives in the arena
+   struct Label
+   {
+      const char * text;
+      int length;
+   };
+
+   // a slot keeps the hash next to the index, so probing past other
+   //    labels and growing the table never have to look at the text
+   struct Slot
+   {
+      unsigned int hash;
+      int index;                    // -1 when the slot is empty
+   };
+
+   custom::vector<Label>  labels;   // index --> label
+   custom::vector<Slot>   slots;
+   custom::vector<char *> blocks;   // the arena
+   int numSlots;                    // a power of two
+   char * filling;                  // the block labels are copied to
+   int blockUsed;                   // bytes used in that block
+
+   int findSlot(std::string_view s, unsigned int hash) const;
+   const char * store(std::string_view s);
+   void grow();
+};
+
+/**********************************************
+ * NAME TABLE : INTERN
+ * Find the label, or copy it into the arena and
+ * give it the next index
+ **********************************************/
+inline int NameTable::intern(std::string_view s)
+{
+   // keep at most half of the slots full
+   if ((size() + 1) * 2 > numSlots)
+      grow();
+
+   unsigned int hash = labelHash(s.data(), s.size(), 0);
+   int slot = findSlot(s, hash);
+   if (slots[slot].index != -1)
+      return slots[slot].index;
+
+   Label label;
+   label.text   = store(s);
+   label.length = s.size();
+   slots[slot].hash  = hash;
+   slots[slot].index = size();
+   labels.push_back(label);
+   return slots[slot].index;
+}
+
+/**********************************************
+ * NAME TABLE : FIND SLOT
+ * Linear probing: the slot holding the label, or
+ * the empty slot where it belongs
+ **********************************************/
+inline int NameTable::findSlot(std::string_view s, unsigned int hash) const
+{
+   int slot = hash & (numSlots - 1);
+   while (slots[slot].index != -1)
+   {
+      if (slots[slot].hash == hash)
+      {
+         const Label & label = labels[slots[slot].index];
+         if (label.length == (int)s.size() &&
+             std::memcmp(label.text, s.data(), s.size()) == 0)
+            break;
+      }
+      slot = (slot + 1) & (numSlots - 1);
+   }
+   return slot;
+}
+
+/**********************************************
+ * NAME TABLE : STORE
+ * Copy a label to the end of the arena
+ **********************************************/
+inline const char * NameTable::store(std::string_view s)
+{
+   // a label too long for a block gets a block of its own
+   if (s.size() > NAME_BLOCK_SIZE / 4)
+   {
+      char * block = new char[s.size()];
+      std::memcpy(block, s.data(), s.size());
+      blocks.push_back(block);
+      return block;
+   }
+
+   if (filling == nullptr || blockUsed + (int)s.size() > NAME_BLOCK_SIZE)
+   {
+      filling = new char[NAME_BLOCK_SIZE];
+      blocks.push_back(filling);
+      blockUsed = 0;
+   }
+
+   char * text = filling + blockUsed;
+   std::memcpy(text, s.data(), s.size());
+   blockUsed += s.size();
+   return text;
+}
+
+/**********************************************
+ * NAME TABLE : GROW
+ * Double the slots and put every label back
+ **********************************************/
+inline void NameTable::grow()
+{
+   custom::vector<Slot> old(slots);
+   Slot empty = { 0, -1 };
+   numSlots = (numSlots == 0 ? 16 : numSlots * 2);
+   slots = custom::vector<Slot>(numSlots, empty);
+   for (int i = 0; i < old.size(); i++)
+   {
+      if (old[i].index == -1)
+         continue;
+      int slot = old[i].hash & (numSlots - 1);
+      while (slots[slot].index != -1)
+         slot = (slot + 1) & (numSlots - 1);
+      slots[slot] = old[i];
+   }
+}
+
+/****************************************************
+ * NAMED  VERTEX
+ * A vertex whose names come from a name table. The
+ * table has to outlive the verticies using it
+ ***************************************************/
+class NamedVertex : public Vertex
+{
+public:
+   NamedVertex() : names(nullptr) { }
+   NamedVertex(const NameTable & names) :
+      Vertex(-1, names.getDomain()), names(&names) { }
+
+   // return the text version of the index: 0 --> the first label
+   string getText() const
+   {
+      if (names == nullptr || i < 0)
+         return string("ERROR");
+      return string(names->nameFromIndex(i));
+   }
+
+   int writeText(char * buffer, int size) const
+   {
+      if (names == nullptr || i < 0)
+         return copyText(buffer, size, "ERROR", 5);
+      std::string_view name = names->nameFromIndex(i);
+      return copyText(buffer, size, name.data(), name.size());
+   }
+
+   // set an index based on the text. Only labels already in the
+   //    table can be used: it is not changed through a vertex
+   bool setText(const string & s)
+   {
+      int index = (names == nullptr ? -1 : names->find(s));
+      if (index < 0)
+         return false;
+      // the table may have grown since this vertex was made
+      setDomain(names->getDomain());
+      this->i = index;
+      return true;
+   }
+
+private:
+   const NameTable * names;
+};
+
+/*********************************************
+ * READ EDGES
+ * Read a list of edges, one "from to" pair of
+ * labels per line, into a graph. Anything after
+ * the second label, such as a weight, is ignored,
+ * and a line whose first non-blank is # is a
+ * comment. The whole file is read at once and the
+ * labels are interned straight from that buffer,
+ * so no string is made per label
+ ********************************************/
+inline custom::BasicGraph<NamedVertex> readEdges(const char * fileName,
+                                                 NameTable & names)
+{
+   // attempt to open the file
+   std::ifstream fin(fileName, std::ios::binary);
+   if (fin.fail())
+   {
+      std::cout << "ERROR: Unable to open file " << fileName << std::endl;
+      return custom::BasicGraph<NamedVertex>(1);
+   }
+
+   // the whole file in one buffer
+   fin.seekg(0, std::ios::end);
+   int length = fin.tellg();
+   fin.seekg(0, std::ios::beg);
+   std::string buffer(length, '\0');
+   fin.read(&buffer[0], length);
+   fin.close();
+
+   // intern the first two labels of every line, remembering the edges as
+   //    pairs of indices
+   custom::vector<int> ends;
+   int numLine = 0;
+   for (int pos = 0; pos < length; pos++)
+   {
+      numLine++;
+      int lineEnd = pos;
+      while (lineEnd < length && buffer[lineEnd] != '\n')
+         lineEnd++;
+
+      // up to two labels, separated by blanks
+      std::string_view labels[2];
+      int numLabels = 0;
+      while (numLabels < 2)
+      {
+         while (pos < lineEnd && (buffer[pos] == ' ' || buffer[pos] == '\t' ||
+                                  buffer[pos] == '\r'))
+            pos++;
+         if (pos == lineEnd || (numLabels == 0 && buffer[pos] == '#'))
+            break;
+
+         int start = pos;
+         while (pos < lineEnd && buffer[pos] != ' ' && buffer[pos] != '\t' &&
+                buffer[pos] != '\r')
+            pos++;
+         labels[numLabels++] = std::string_view(buffer.data() + start, pos - start);
+      }
+
+      if (numLabels == 2)
+      {
+         ends.push_back(names.intern(labels[0]));
+         ends.push_back(names.intern(labels[1]));
+      }
+      else if (numLabels == 1)
+         std::cout << "ERROR: Line " << numLine << " of " << fileName
+                   << " has only one label" << std::endl;
+      pos = lineEnd;
+   }
+
+   // now the number of verticies is known, put the edges into the Graph
+   custom::BasicGraph<NamedVertex> g(names.getDomain());
+   NamedVertex vFrom(names);
+   NamedVertex vTo(names);
+   for (int i = 0; i + 1 < ends.size(); i += 2)
+   {
+      vFrom.set(ends[i]);
+      vTo.set(ends[i + 1]);
+      g.add(vFrom, vTo);
+   }
+
+   return g;
+}
+
+#endif // NAMED_VERTEX_H
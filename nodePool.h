@@ -0,0 +1,213 @@
+/***********************************************************************
+* Header:
+*    NODE POOL
+* Summary:
+*    This class contains the places a linked container gets its nodes
+*    from. Rather than one trip to the global allocator per node, a
+*    pool carves its nodes out of slabs of many, and keeps the nodes
+*    given back in a free list for the next ones asked for.
+*    Of particular interest is where the nodes end up: nodes made one
+*    after the other sit side by side in a slab, so walking a list
+*    walks through memory instead of jumping around the heap.
+*
+*    This will contain the class definition of:
+*       nodePool <N>        : a slab and free list allocator, one per list
+*       sharedPool <N>      : a nodePool several lists take nodes from
+*       newAllocator <N>    : plain new and delete for every node
+* Author
+*    Daniel Perez, Jamie Hurd, Benjamin Dyas
+************************************************************************/
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <new>          // for BAD_ALLOC
+
+// the first slab holds this many nodes, each one after it twice as many
+//    up to the most
+#define NODE_POOL_FIRST_SLAB 16
+#define NODE_POOL_MAX_SLAB   4096
+
+namespace custom
+{
+   /************************************************
+    * NODE POOL
+    * Memory for nodes of type N, which are built
+    * and destroyed by the container. A copy is a
+    * new, empty pool: nodes are never shared
+    * between two pools
+    ***********************************************/
+   template <class N>
+   class nodePool
+   {
+   public:
+      nodePool() : pFree(nullptr), pSlabs(nullptr), pBump(nullptr),
+                   pBumpEnd(nullptr), numNextSlab(NODE_POOL_FIRST_SLAB) {}
+      nodePool(const nodePool & rhs) : nodePool() {}
+      nodePool & operator = (const nodePool & rhs) { return *this; }
+      ~nodePool();
+
+      void * allocate();
+      void   deallocate(void * p);
+
+      // can a node from rhs be given back to this one?
+      bool operator == (const nodePool & rhs) const { return this == &rhs; }
+      bool operator != (const nodePool & rhs) const { return this != &rhs; }
+
+   private:
+      // a free node holds the next free node
+      union Slot
+      {
+         Slot * pNext;
+         alignas(N) unsigned char bytes[sizeof(N)];
+      };
+
+      struct Slab
+      {
+         Slab * pNext;
+         Slot * slots;
+      };
+
+      Slot * pFree;        // nodes given back
+      Slab * pSlabs;       // every slab, to free at the end
+      Slot * pBump;        // the part of the newest slab never given out
+      Slot * pBumpEnd;
+      int numNextSlab;
+
+      void newSlab();
+   };
+
+   /************************************************
+    * SHARED POOL
+    * Takes nodes from a nodePool that belongs to
+    * someone else, so several lists can share one
+    * and hand nodes to each other. The nodePool
+    * has to outlive them all
+    ***********************************************/
+   template <class N>
+   class sharedPool
+   {
+   public:
+      sharedPool() : pPool(nullptr) {}
+      sharedPool(nodePool <N> & pool) : pPool(&pool) {}
+
+      void * allocate()         { return pool().allocate(); }
+      void   deallocate(void * p) { pool().deallocate(p);   }
+
+      bool operator == (const sharedPool & rhs) const { return pPool == rhs.pPool; }
+      bool operator != (const sharedPool & rhs) const { return pPool != rhs.pPool; }
+
+   private:
+      nodePool <N> * pPool;
+
+      nodePool <N> & pool()
+      {
+         if (pPool == nullptr)
+            throw "ERROR: Unable to allocate a node without a pool to share";
+         return *pPool;
+      }
+   };
+
+   /************************************************
+    * NEW ALLOCATOR
+    * Every node on its own from the global
+    * allocator. Any node can go back to any one,
+    * which is why a list uses it by default
+    ***********************************************/
+   template <class N>
+   class newAllocator
+   {
+   public:
+      void * allocate()
+      {
+         try
+         {
+            return ::operator new(sizeof(N));
+         }
+         catch (std::bad_alloc &)
+         {
+            throw "ERROR: Unable to allocate a new node";
+         }
+      }
+      void deallocate(void * p) { ::operator delete(p); }
+
+      bool operator == (const newAllocator & rhs) const { return true;  }
+      bool operator != (const newAllocator & rhs) const { return false; }
+   };
+
+   /**********************************************
+    * NODE POOL : DESTRUCTOR
+    * Every node must have been destroyed already
+    **********************************************/
+   template <class N>
+   nodePool <N> :: ~nodePool()
+   {
+      while (pSlabs != nullptr)
+      {
+         Slab * pNext = pSlabs->pNext;
+         delete [] pSlabs->slots;
+         delete pSlabs;
+         pSlabs = pNext;
+      }
+   }
+
+   /**********************************************
+    * NODE POOL : ALLOCATE
+    * A node given back, else the next one never
+    * given out, else a new slab
+    **********************************************/
+   template <class N>
+   void * nodePool <N> :: allocate()
+   {
+      if (pFree != nullptr)
+      {
+         Slot * pSlot = pFree;
+         pFree = pFree->pNext;
+         return pSlot;
+      }
+
+      if (pBump == pBumpEnd)
+         newSlab();
+      return pBump++;
+   }
+
+   /**********************************************
+    * NODE POOL : DEALLOCATE
+    * The node goes on the front of the free list
+    **********************************************/
+   template <class N>
+   void nodePool <N> :: deallocate(void * p)
+   {
+      Slot * pSlot = static_cast <Slot *> (p);
+      pSlot->pNext = pFree;
+      pFree = pSlot;
+   }
+
+   /**********************************************
+    * NODE POOL : NEW SLAB
+    **********************************************/
+   template <class N>
+   void nodePool <N> :: newSlab()
+   {
+      Slab * pSlab = nullptr;
+      try
+      {
+         pSlab = new Slab;
+         pSlab->slots = new Slot[numNextSlab];
+      }
+      catch (std::bad_alloc &)
+      {
+         delete pSlab;
+         throw "ERROR: Unable to allocate a new slab of nodes";
+      }
+
+      pSlab->pNext = pSlabs;
+      pSlabs = pSlab;
+      pBump = pSlab->slots;
+      pBumpEnd = pSlab->slots + numNextSlab;
+
+      if (numNextSlab < NODE_POOL_MAX_SLAB)
+         numNextSlab *= 2;
+   }
+}; //end namespace custom
+
+#endif // NODE_POOL_H
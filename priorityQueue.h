@@ -0,0 +1,362 @@
+/***********************************************************************
+* Header:
+*    PRIORITY QUEUE
+* Summary:
+*    This class contains the notion of a priority queue: a bucket of
+*    ids, such as vertex indices, each with a key, where the only
+*    accessible member is the id with the smallest key (aka top()).
+*    That is the order Dijkstra's or A*'s open list wants.
+*    Of particular interest is the heap being d-ary: every item has D
+*    children side by side, so the heap is only log base D deep, and
+*    picking the smallest child reads one or two cache lines. Next to
+*    the heap is the position of every id in it, so the key of an id
+*    can be lowered in place instead of pushing it a second time.
+*
+*    This will contain the class definition of:
+*       priority_queue         : an indexed min-heap of ids 0 ... n-1
+* Author
+*    Benjamin Dyas, Daniel Perez
+************************************************************************/
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <new>          // for BAD_ALLOC
+
+namespace custom
+{
+   /************************************************
+    * PRIORITY QUEUE
+    * Holds each id from 0 to capacity() - 1 at most
+    * once. T only needs operator <
+    ***********************************************/
+   template <class T, int D = 4>
+   class priority_queue
+   {
+      static_assert(D >= 2, "a heap needs at least two children per item");
+
+   public:
+      // constructors, destructors
+      priority_queue() : heap(nullptr), positions(nullptr),
+                         numElements(0), numIds(0) {}
+      explicit priority_queue(int numIds);
+      priority_queue(const T * keys, int numIds);
+      priority_queue(const priority_queue & rhs);
+      ~priority_queue() { release(); }
+
+      // overloaded operators
+      priority_queue & operator = (const priority_queue & rhs);
+
+      // container interfaces
+      int   size()      const { return numElements; }
+      int   capacity()  const { return numIds; }
+      bool  empty()     const { return numElements == 0; }
+      void  clear();
+
+      // priority queue specific
+      void       push(int id, const T & key);
+      void       pop();
+      int        top()    const;
+      const T &  topKey() const;
+
+      // by id
+      bool       contains(int id) const
+                    { return id >= 0 && id < numIds && positions[id] != -1; }
+      const T &  key(int id) const;
+      void       decreaseKey(int id, const T & key);
+
+      // every id from 0 to num - 1 at once, in linear time
+      void       heapify(const T * keys, int num);
+
+   private:
+      struct Entry
+      {
+         T key;
+         int id;
+      };
+
+      //member variables
+      Entry * heap;
+      int * positions;          // where each id is in the heap, -1 if absent
+      int numElements;
+      int numIds;
+
+      //methods
+      void allocate(int numIds);
+      void release();
+      void siftUp(int i, const Entry & entry);
+      void siftDown(int i, const Entry & entry);
+      void place(int i, const Entry & entry)
+      {
+         heap[i] = entry;
+         positions[entry.id] = i;
+      }
+   };
+
+   /**********************************************
+    * PRIORITY QUEUE : NON-DEFAULT CONSTRUCTOR
+    * Room for ids 0 to numIds - 1, none there yet
+    **********************************************/
+   template <class T, int D>
+   priority_queue<T, D>::priority_queue(int numIds) :
+      heap(nullptr), positions(nullptr), numElements(0), numIds(0)
+   {
+      allocate(numIds);
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : HEAPIFY CONSTRUCTOR
+    * Every id there, id i with keys[i]
+    **********************************************/
+   template <class T, int D>
+   priority_queue<T, D>::priority_queue(const T * keys, int numIds) :
+      heap(nullptr), positions(nullptr), numElements(0), numIds(0)
+   {
+      heapify(keys, numIds);
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : COPY CONSTRUCTOR
+    **********************************************/
+   template <class T, int D>
+   priority_queue<T, D>::priority_queue(const priority_queue<T, D> & rhs) :
+      heap(nullptr), positions(nullptr), numElements(0), numIds(0)
+   {
+      *this = rhs;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : ASSIGNMENT OPERATOR
+    **********************************************/
+   template <class T, int D>
+   priority_queue<T, D> & priority_queue<T, D>::operator = (const priority_queue<T, D> & rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      release();
+      allocate(rhs.numIds);
+      for (int i = 0; i < rhs.numElements; i++)
+         heap[i] = rhs.heap[i];
+      for (int id = 0; id < rhs.numIds; id++)
+         positions[id] = rhs.positions[id];
+      numElements = rhs.numElements;
+      return *this;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : CLEAR
+    * Only the ids that are there need forgetting
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::clear()
+   {
+      for (int i = 0; i < numElements; i++)
+         positions[heap[i].id] = -1;
+      numElements = 0;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : PUSH
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::push(int id, const T & key)
+   {
+      if (id < 0 || id >= numIds)
+         throw "ERROR: Unable to push an id out of the range of the priority_queue";
+      if (positions[id] != -1)
+         throw "ERROR: Unable to push an id already in the priority_queue";
+
+      Entry entry;
+      entry.key = key;
+      entry.id = id;
+      siftUp(numElements++, entry);
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : POP
+    * The last item fills the hole at the root
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::pop()
+   {
+      if (numElements == 0)
+         return;
+
+      positions[heap[0].id] = -1;
+      if (--numElements > 0)
+         siftDown(0, heap[numElements]);
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : TOP
+    * The id with the smallest key
+    **********************************************/
+   template <class T, int D>
+   int priority_queue<T, D>::top() const
+   {
+      if (numElements == 0)
+         throw "ERROR: Unable to reference the element from an empty priority_queue";
+      return heap[0].id;
+   }
+
+   template <class T, int D>
+   const T & priority_queue<T, D>::topKey() const
+   {
+      if (numElements == 0)
+         throw "ERROR: Unable to reference the element from an empty priority_queue";
+      return heap[0].key;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : KEY
+    **********************************************/
+   template <class T, int D>
+   const T & priority_queue<T, D>::key(int id) const
+   {
+      if (!contains(id))
+         throw "ERROR: Unable to find the id in the priority_queue";
+      return heap[positions[id]].key;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : DECREASE KEY
+    * A smaller key can only move an item up
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::decreaseKey(int id, const T & key)
+   {
+      if (!contains(id))
+         throw "ERROR: Unable to find the id in the priority_queue";
+      if (heap[positions[id]].key < key)
+         throw "ERROR: Unable to decrease a key to a larger one";
+
+      Entry entry;
+      entry.key = key;
+      entry.id = id;
+      siftUp(positions[id], entry);
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : HEAPIFY
+    * Put everything in, then sift down every item
+    * that has children, the last one first. Most
+    * items are near the bottom and barely move, so
+    * this is linear where num pushes are not
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::heapify(const T * keys, int num)
+   {
+      if (num > numIds)
+      {
+         release();
+         allocate(num);
+      }
+      else
+         clear();
+
+      for (int id = 0; id < num; id++)
+      {
+         Entry entry;
+         entry.key = keys[id];
+         entry.id = id;
+         place(id, entry);
+      }
+      numElements = num;
+
+      for (int i = (num - 2) / D; i >= 0 && num > 1; i--)
+      {
+         Entry entry = heap[i];
+         siftDown(i, entry);
+      }
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : ALLOCATE
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::allocate(int numIds)
+   {
+      if (numIds <= 0)
+         return;
+
+      try
+      {
+         heap = new Entry[numIds];
+         positions = new int[numIds];
+      }
+      catch (std::bad_alloc &)
+      {
+         release();
+         throw "ERROR: Unable to allocate a new buffer for priority_queue";
+      }
+
+      for (int id = 0; id < numIds; id++)
+         positions[id] = -1;
+      this->numIds = numIds;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : RELEASE
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::release()
+   {
+      delete [] heap;
+      delete [] positions;
+      heap = nullptr;
+      positions = nullptr;
+      numElements = 0;
+      numIds = 0;
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : SIFT UP
+    * Put entry in the hole at i: bigger parents
+    * move down into the hole until one is not
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::siftUp(int i, const Entry & entry)
+   {
+      while (i > 0)
+      {
+         int iParent = (i - 1) / D;
+         if (!(entry.key < heap[iParent].key))
+            break;
+         place(i, heap[iParent]);
+         i = iParent;
+      }
+      place(i, entry);
+   }
+
+   /**********************************************
+    * PRIORITY QUEUE : SIFT DOWN
+    * Put entry in the hole at i: the smallest
+    * child moves up into the hole while it is
+    * smaller than entry
+    **********************************************/
+   template <class T, int D>
+   void priority_queue<T, D>::siftDown(int i, const Entry & entry)
+   {
+      for (;;)
+      {
+         int iChild = D * i + 1;
+         if (iChild >= numElements)
+            break;
+
+         // the smallest of up to D children, all next to each other
+         int iLast = (iChild + D < numElements ? iChild + D : numElements);
+         int iSmallest = iChild;
+         for (int iSibling = iChild + 1; iSibling < iLast; iSibling++)
+            if (heap[iSibling].key < heap[iSmallest].key)
+               iSmallest = iSibling;
+
+         if (!(heap[iSmallest].key < entry.key))
+            break;
+         place(i, heap[iSmallest]);
+         i = iSmallest;
+      }
+      place(i, entry);
+   }
+}; //end namespace custom
+
+#endif // PRIORITY_QUEUE_H
@@ -7,7 +7,8 @@
 *    accessible members are the first item to have been pushed (aka front())
 *    and the last element (back()). It uses the first in, first out rule.
 *    Of particular interest is the double access being handled with a
-*    wrapping of the array, to avoid queue creep.
+*    wrapping of the array, to avoid queue creep. The capacity is always
+*    a power of two, so wrapping is a mask instead of a division.
 *
 *    This will contain the class definition of:
 *       queue                  : similar to std::queue
@@ -17,6 +18,10 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
+#include <cstring>      // for MEMCPY
+#include <new>          // for BAD_ALLOC
+#include <type_traits>
+
 namespace custom
 {
     /************************************************
@@ -39,7 +44,7 @@ namespace custom
         queue& operator = (const queue& rhs);
 
         // container interfaces
-        int     size()      const   { return numPush - numPop; }
+        int     size()      const   { return (int)(numPush - numPop); }
         int     capacity()  const   { return numCapacity; }
         bool    empty()     const   { return ( size() == 0); }
         void    clear()             { numPush = numPop = 0; }
@@ -56,42 +61,48 @@ namespace custom
     private:
         //member variables
         T * data;
-        int numCapacity;
-        int numPush;
-        int numPop;
+        int numCapacity;        // zero or a power of two
+        unsigned int numPush;   // these only ever grow, and may wrap
+        unsigned int numPop;    //    around: the size is their difference
 
 
         //methods
         void resize(int newCapacity);
-        int  iTail() { return (numPush - 1) % numCapacity; }
-        int  iHead() { return numPop % numCapacity; }
+        void copyTo(T * pDest) const;
+        static int roundUp(int num);
+        int  iTail() const { return (numPush - 1) & (numCapacity - 1); }
+        int  iHead() const { return numPop & (numCapacity - 1); }
     };
 
     /**********************************************
     * QUEUE : NON-DEFAULT CONSTRUCTOR
-    * Preallocate the array to "numCapacity"
+    * Preallocate the array to "numCapacity",
+    * rounded up to a power of two
     **********************************************/
     template <class T>
     queue<T>::queue(int numCapacity) {
 
+        this->numPop = 0;
+        this->numPush = 0;
+        this->numCapacity = 0;
+        data = nullptr;
+        if (numCapacity < 1)
+            return;
+
+        numCapacity = roundUp(numCapacity);
         try
         {
             data = new T[numCapacity];
         }
-        catch (std::bad_alloc)
+        catch (std::bad_alloc &)
         {
             //if allocation fails, create an empty queue with numCapacity zero
-            data = nullptr; 
-            this->numCapacity = 0;
             //we could have delegated this to the default constructor
             
             throw "ERROR: Unable to allocate a new buffer for queue";
         }
 
         this->numCapacity = numCapacity;
-        this->numPop = 0;
-        this->numPush = 0;
-
     }
 
     /**********************************************
@@ -112,11 +123,12 @@ namespace custom
         }
 
         // attempt to allocate
+        numCapacity = roundUp(rhs.size());
         try
         {
-            data = new T[rhs.size()];
+            data = new T[numCapacity];
         }
-        catch (std::bad_alloc)
+        catch (std::bad_alloc &)
         {
             //to verify later on in case allocation fails
             data = nullptr;
@@ -124,15 +136,9 @@ namespace custom
             throw "ERROR: Unable to allocate buffer";
         }
 
-        // copy over the capacity
-        this->numCapacity = rhs.size();
-
-        // copy the items over one at a time using the assignment operator        
-        for (int i = rhs.numPop; i < rhs.numPush; i++)
-        {
-            push(rhs.data[i % rhs.numCapacity]);
-        }
-            
+        // copy the items over, the front one first
+        rhs.copyTo(data);
+        numPush = rhs.size();
     }
 
     /**********************************************
@@ -142,7 +148,9 @@ namespace custom
     template <class T>
     queue<T>& queue<T>::operator=(const queue<T>& rhs)
     {
-        
+        if (this == &rhs)
+            return *this;
+
         numPush = 0;
         numPop = 0;
 
@@ -152,11 +160,9 @@ namespace custom
             this->resize(rhs.size());
         }
 
-        //Copy data from source to local array
-        for (int i = rhs.numPop; i < rhs.numPush; i++)
-        {
-            push(rhs.data[i % rhs.size()]);
-        }
+        //Copy data from source to local array, the front one first
+        rhs.copyTo(data);
+        numPush = rhs.size();
 
         return *this;
 
@@ -285,10 +291,7 @@ namespace custom
         // This happens when vector is default constructed with a 
         //    size and capacity of zero. The first time it doesn't double:
         //    it goes from zero to one
-        if (max == 0)
-        {
-            max = 1;
-        }
+        max = roundUp(max);
 
         // create a temporary pointer for array swap
         T* tempData = nullptr;
@@ -298,18 +301,14 @@ namespace custom
         {
             tempData = new T[max];
         }
-        catch (std::bad_alloc)
+        catch (std::bad_alloc &)
         {
             throw "ERROR: Unable to allocate a new buffer for Queue.";
-            return;
         }
-        //Copy data from source to local array
 
-        int tempPush = 0;
-        for (int i = numPop; i < numPush; i++)
-        {
-            tempData[tempPush++] = data[i % size()];
-        }
+        //Copy data from source to local array, unwrapped
+        int tempPush = size();
+        copyTo(tempData);
 
         delete[] data;
         
@@ -322,6 +321,55 @@ namespace custom
         this->numCapacity = max;
 
     }
+
+    /**********************************************
+    * QUEUE : COPY TO
+    * Copy the items, the front one first, to the
+    * start of another array. They are at most two
+    * runs: from the head to the end of the array,
+    * and from the start of the array to the tail
+    **********************************************/
+    template <class T>
+    void queue<T> ::copyTo(T * pDest) const
+    {
+        if (empty())
+            return;
+
+        int iBegin = iHead();
+        int numFirst = numCapacity - iBegin;
+        if (numFirst > size())
+            numFirst = size();
+        int numSecond = size() - numFirst;
+
+        if constexpr (std::is_trivially_copyable <T>::value)
+        {
+            std::memcpy((void *)pDest, (const void *)(data + iBegin),
+                        sizeof(T) * numFirst);
+            std::memcpy((void *)(pDest + numFirst), (const void *)data,
+                        sizeof(T) * numSecond);
+        }
+        else
+        {
+            for (int i = 0; i < numFirst; i++)
+                pDest[i] = data[iBegin + i];
+            for (int i = 0; i < numSecond; i++)
+                pDest[numFirst + i] = data[i];
+        }
+    }
+
+    /**********************************************
+    * QUEUE : ROUND UP
+    * The smallest power of two that is at least
+    * num, and at least one
+    **********************************************/
+    template <class T>
+    int queue<T> ::roundUp(int num)
+    {
+        int capacity = 1;
+        while (capacity < num)
+            capacity *= 2;
+        return capacity;
+    }
 }; //end namespace custom    
 
-#endif // queue_H
\ No newline at end of file
+#endif // queue_H
@@ -15,28 +15,42 @@
 #ifndef SET_H
 #define SET_H
 #include <cstddef>
+#include <algorithm>
+#include "smallBuffer.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define SET_GALLOP_RATIO 16   // size ratio where intersecting gallops
+#define SET_SEARCH_BLOCK 16   // items scanned at the end of a search
+#define SET_RADIX_MIN    256  // fewer ints than this are not radix sorted
 
 namespace custom
 {
    /************************************************
     * SET
-    * Container class that holds unique values
+    * Container class that holds unique values.
+    * The first N of them are kept inside the set
+    * itself: a set that never holds more than N
+    * items never allocates
     ***********************************************/
-   template <class T>
-   class set
+   template <class T, int N = 0>
+   class set : private SmallBuffer <T, N>
    {
    public:
       // constructors & destructor
-      set() :numCapacity{ 0 }, numElements{ 0 }, data{ nullptr } {}
+      set() :numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() } {}
       set(int numElements);
+      template <class Iterator>
+      set(Iterator first, Iterator last);
       set(const set & rhs);
-      ~set() { if(data!= nullptr)delete [] data; }
+      ~set() { release(); }
 
       // overloaded operators
       set & operator =  (const set & rhs);
-      set operator && (const set & rhs);
-      set operator || (const set & rhs);
-      set operator -  (const set & rhs);
+      set operator && (const set & rhs) const;
+      set operator || (const set & rhs) const;
+      set operator -  (const set & rhs) const;
 
       // standard container interfaces
       int   size()      const { return numElements; }
@@ -64,8 +78,10 @@ namespace custom
       const_iterator cend() const;
 
       // set-specific interfaces
-      iterator    find(T  t); //should this be a reference?
-      void        insert(T  t);
+      iterator    find(const T & t);
+      void        insert(const T & t);
+      template <class Iterator>
+      void        insert(Iterator first, Iterator last);
       iterator    erase(iterator it);
 
    private:
@@ -75,8 +91,24 @@ namespace custom
       int numCapacity;
 
       //member functions
-      int findIndex(T t);
+      void adopt(set & rhs);
+      T * allocate(int num);
+      void release() { if (data != nullptr && !isInline()) delete [] data; }
+
+      //are the items in the room inside the set?
+      bool isInline() const { return N > 0 && data == this->inlineData(); }
+      int sortUnique();
+      int findIndex(const T & t) const;
+      int lowerBound(const T & t) const;
+      int gallop(int iBegin, const T & t) const;
       void resize(int newCapacity);
+
+      //is one set so much smaller that searching the other for each
+      //   of its items beats walking both?
+      static bool isMuchSmaller(const set & lhs, const set & rhs)
+      {
+         return lhs.numElements * SET_GALLOP_RATIO < rhs.numElements;
+      }
    }; // end class declaration
 
 /************************************************** CONSTRUCTOR DEFINITION ***/
@@ -85,30 +117,18 @@ namespace custom
     * set : NON-DEFAULT CONSTRUCTOR
     * Preallocate the array to "capacity"
     **********************************************/
-   template <class T>
-   set<T>::set(int numElements)
+   template <class T, int N>
+   set<T, N>::set(int numElements)
    { 
-      //in case a zero or negative number is passed
-      if (numElements < 1)
+      //in case a zero or negative number is passed, or a number that
+      //   fits inside the set anyway
+      if (numElements < N)
       {
-         this->numCapacity = 0; //this was commented out, why?
-         this->numElements = 0;
-         this->data = nullptr;
-
-         return;
+         numElements = N;
       }
 
-      try
-      {
-         data = new T[numElements];
-      }
-      catch (...)
-      {
-         //to verify later on in case allocation fails
-         data = nullptr;
-
-         throw "ERROR: Unable to allocate a new buffer for set.";
-      }
+      //nullptr if there is no room at all
+      data = allocate(numElements);
 
       //initially capacity and size are the same
       this->numCapacity = numElements;
@@ -118,49 +138,58 @@ namespace custom
    /*******************************************
     * set :: COPY CONSTRUCTOR
     *******************************************/
-   template <class T>
-   set<T> :: set(const set <T>& rhs)
+   template <class T, int N>
+   set<T, N> :: set(const set <T, N>& rhs) :
+      numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() }
    {
       //assert(rhs.numElements >= 0);
 
-      // do nothing if there is nothing to do
-      if (rhs.numElements == 0)
+      // only the items are copied, so only they have to fit
+      if (rhs.numElements > N)
       {
-         numElements = 0; //this was commented out, why?
-         numCapacity = 0; //this was commented out, why?
-         data = nullptr;
-         return;
-      }
-
-      // attempt to allocate
-      try
-      {
-         data = new T[rhs.numElements];
-      }
-      catch (...)
-      {
-         //to verify later on in case allocation fails
-         data = nullptr;
-
-         throw "ERROR: Unable to allocate a new buffer for set.";
+         data = allocate(rhs.numElements);
+         this->numCapacity = rhs.numElements;
       }
-
-      // copy over the capacity
       this->numElements = rhs.numElements;
-      this->numCapacity = rhs.numCapacity;
 
       // copy the items over one at a time using the assignment operator
       for (int i = 0; i < numElements; i++)
          data[i] = rhs.data[i];
    }
 
+   /*******************************************
+    * set :: RANGE CONSTRUCTOR
+    * Fill the set from any range at once: copy
+    * the items in, sort them, and drop the
+    * duplicates. The buffer they were copied to
+    * becomes the set, so that is the only copy
+    *******************************************/
+   template <class T, int N>
+   template <class Iterator>
+   set<T, N> :: set(Iterator first, Iterator last) :
+      numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() }
+   {
+      int num = 0;
+      for (Iterator it = first; it != last; ++it)
+         num++;
+      if (num > N)
+      {
+         data = allocate(num);
+         numCapacity = num;
+      }
+
+      for (Iterator it = first; it != last; ++it)
+         data[numElements++] = *it;
+      numElements = sortUnique();
+   }
+
 /***************************************** OVERLOADED OPERATORS DEFINITION ***/
 
    /********************************************
     * SET : ASSIGNMENT OPERATOR OVERLOAD
     ********************************************/
-   template <class T>
-   set <T>& set <T> :: operator = (const set <T>& rhs)
+   template <class T, int N>
+   set <T, N>& set <T, N> :: operator = (const set <T, N>& rhs)
    {
       // if incoming object is bigger, resize allocated space
       if ( rhs.size() > this->capacity() )
@@ -186,36 +215,48 @@ namespace custom
     *          found on both sets.
     * PARAMETER: A set by reference
     ********************************************/
-   template <class T>
-   set <T> set <T> :: operator && (const set <T>& rhs)
+   template <class T, int N>
+   set <T, N> set <T, N> :: operator && (const set <T, N>& rhs) const
    {
-      int iLhs = 0;
-      int iRhs = 0;
-      set <T> setReturn;
-
-      //While we don't make it to the end of either set
-      while( iLhs < this->numElements || iRhs < rhs.size() )
-      {  
-         //This seems redundant, but if we make it to the end
-         //   return the result so far.
-         if ( iLhs == this->numElements )
-         {
-            return setReturn;
-         }
-         else if ( iRhs == rhs.size() )
+      //the result can't be bigger than the smaller set
+      set <T, N> setReturn( numElements < rhs.numElements ?
+                         numElements : rhs.numElements );
+
+      //when one set is much smaller, jump through the bigger one
+      //   instead of walking every item of it
+      if ( isMuchSmaller(*this, rhs) || isMuchSmaller(rhs, *this) )
+      {
+         const set <T, N> & small = (numElements < rhs.numElements ? *this : rhs);
+         const set <T, N> & large = (numElements < rhs.numElements ? rhs : *this);
+         int iLarge = 0;
+         for (int iSmall = 0; iSmall < small.numElements; iSmall++)
          {
-            return setReturn;
+            iLarge = large.gallop(iLarge, small.data[iSmall]);
+            if ( iLarge == large.numElements )
+               break;
+            if ( large.data[iLarge] == small.data[iSmall] )
+               setReturn.data[setReturn.numElements++] = small.data[iSmall];
          }
-         //If an item matches, insert it in the result and 
+         return setReturn;
+      }
+
+      int iLhs = 0;
+      int iRhs = 0;
+
+      //While we don't make it to the end of either set. The items
+      //   come out sorted, so they go straight to the end of the result
+      while( iLhs < this->numElements && iRhs < rhs.numElements )
+      {
+         //If an item matches, add it to the result and 
          //  move along on both sets
-         else if ( this->data[iLhs] == rhs[iRhs] )
+         if ( this->data[iLhs] == rhs.data[iRhs] )
          {
-            setReturn.insert( data[iLhs] );
+            setReturn.data[setReturn.numElements++] = data[iLhs];
             iLhs++;
             iRhs++;
          }
          // if the left is lesser/smaller, advance it
-         else if (this->data[iLhs] < rhs[iRhs])
+         else if (this->data[iLhs] < rhs.data[iRhs])
          {
             iLhs++;
          }
@@ -234,49 +275,46 @@ namespace custom
     *          items of both sets.
     * PARAMETER: A set by reference
     ********************************************/
-   template <class T>
-   set <T> set <T> :: operator || (const set <T>& rhs)
+   template <class T, int N>
+   set <T, N> set <T, N> :: operator || (const set <T, N>& rhs) const
    {
-   
       int iLhs = 0;
       int iRhs = 0;
-      set <T> setReturn;
 
-      //This seems redundant, but if we make it to the end
-      //   return the result so far.
-      while( iLhs < this->numElements || iRhs < rhs.size() )
+      //the result can't be bigger than both sets together
+      set <T, N> setReturn(numElements + rhs.numElements);
+      T * pReturn = setReturn.data;
+
+      //The items come out sorted, so they go straight to the end
+      //   of the result
+      while( iLhs < this->numElements && iRhs < rhs.numElements )
       {
-         //If the lhs set makes it to the end, add the rest of
-         //   the rhs set
-         if ( iLhs == this->numElements )
-         {
-            setReturn.insert( rhs[iRhs++] );
-         }
-         //If the rhs set makes it to the end, add the rest of
-         //   the lhs set
-         else if ( iRhs == rhs.size() )
-         {
-            setReturn.insert( data[iLhs++] );
-         }
          //If they are the same, just add one, it doesn't matter
-         else if ( this->data[iLhs] == rhs[iRhs] )
+         if ( this->data[iLhs] == rhs.data[iRhs] )
          {
-            setReturn.insert( data[iLhs] );
+            *pReturn++ = data[iLhs];
             iLhs++;
             iRhs++;
          }
          //if the left is lesser, add it and move along
-         else if (this->data[iLhs] < rhs[iRhs])
+         else if (this->data[iLhs] < rhs.data[iRhs])
          {
-            setReturn.insert( data[iLhs++] );
+            *pReturn++ = data[iLhs++];
          }
          else
          {
-            setReturn.insert( rhs[iRhs++] );
+            *pReturn++ = rhs.data[iRhs++];
          }
       }
-      return setReturn;
 
+      //One of the sets made it to the end, add the rest of the other
+      while ( iLhs < this->numElements )
+         *pReturn++ = data[iLhs++];
+      while ( iRhs < rhs.numElements )
+         *pReturn++ = rhs.data[iRhs++];
+
+      setReturn.numElements = pReturn - setReturn.data;
+      return setReturn;
    }
 
    /********************************************
@@ -285,44 +323,58 @@ namespace custom
     *          but not in another. non-commutative
     * PARAMETER: A set by reference.
     ********************************************/
-   template <class T>
-   set <T> set <T> :: operator - (const set <T>& rhs)
+   template <class T, int N>
+   set <T, N> set <T, N> :: operator - (const set <T, N>& rhs) const
    {     
       int iLhs = 0;
       int iRhs = 0;
-      set <T> setReturn;
+
+      //the result can't be bigger than the left hand side
+      set <T, N> setReturn(numElements);
+      T * pReturn = setReturn.data;
 
       //we only really have to check the left hand side
       //   everything else can be discarded as it not found on the left
-      while( iLhs < this->numElements)
+      if ( isMuchSmaller(*this, rhs) )
       {
-         if ( iRhs == rhs.size() )
+         //few items on the left: jump through the right looking for them
+         for ( ; iLhs < this->numElements; iLhs++)
          {
-            //if the rhs makes it to the end, just add everything of the lhs
-            setReturn.insert( data[iLhs++] );
+            iRhs = rhs.gallop(iRhs, data[iLhs]);
+            if ( iRhs == rhs.numElements || !(rhs.data[iRhs] == data[iLhs]) )
+               *pReturn++ = data[iLhs];
          }
-         else if ( this->data[iLhs] == rhs[iRhs] )
+      }
+      else
+      {
+         while( iLhs < this->numElements && iRhs < rhs.numElements )
          {
-            //setReturn.insert( data[iLhs] ); //if they match we don't add them, hence the subraction
-            iLhs++;
-            iRhs++;
-         }
-         else if (this->data[iLhs] < rhs[iRhs])
-         {  
-            //if the data on the left hand side is less than rhs,
-            //   keep adding it until we catch up to the right's size
-            //   same as if the right makes it to the end.
-            setReturn.insert( data[iLhs++] );
+            if ( this->data[iLhs] == rhs.data[iRhs] )
+            {
+               //if they match we don't add them, hence the subraction
+               iLhs++;
+               iRhs++;
+            }
+            else if (this->data[iLhs] < rhs.data[iRhs])
+            {  
+               //if the data on the left hand side is less than rhs,
+               //   keep adding it until we catch up to the right's size
+               *pReturn++ = data[iLhs++];
+            }
+            else
+            {
+               //if the left is higher than the right but they don't match
+               //   increment the right until it catches up
+               iRhs++;
+            }
          }
-         else
-         {
-
-            //if the left is higher than the right but they don't match
-            //   increment the right until it catches up
-            iRhs++;
 
-         }
+         //if the rhs makes it to the end, just add everything of the lhs
+         while ( iLhs < this->numElements )
+            *pReturn++ = data[iLhs++];
       }
+
+      setReturn.numElements = pReturn - setReturn.data;
       return setReturn;
    }
 
@@ -334,8 +386,8 @@ namespace custom
     * the search, otherwise return an interator
     * to the end()
     *******************************************/
-   template <class T>
-   typename set <T>::iterator set<T>::find(T t)
+   template <class T, int N>
+   typename set <T, N>::iterator set<T, N>::find(const T & t)
    {
       //the name of the array is a pointer to the first element
       iterator it;
@@ -352,64 +404,61 @@ namespace custom
     * Insert an element into the set. If already
     * existent, do nothing.
     *******************************************/
-   template <class T>
-   void set<T>::insert(T element)
+   template <class T, int N>
+   void set<T, N>::insert(const T & element)
    {
-      
+      //where it is, or where it should be
+      int iInsert = lowerBound(element);
+
+      //if it's already there, don't do anything
+      if( iInsert < numElements && data[iInsert] == element )
+      {
+         return;
+      }
+
       //if needed resize
       if(this->capacity() == this->size()) //size() + 1 == numElements + 1
       {
          resize( numCapacity * 2 );
       }
-      
-      //if it's already there, don't do anything
-      if( findIndex(element) != numElements )
+
+      //shift the larger elements up one slot
+      for(int i = numElements; i > iInsert; i--)
       {
-         return;
+         data[i] = data[i-1];
       }
 
-      int iInsert = findIndex(element);
-      int i;
+      data[iInsert] = element;
+      numElements++;
+   }
 
-      //as long as it is not already there
-      if (data[iInsert] != element)
+   /********************************************
+    * SET : INSERT
+    * Insert a whole range: it is sorted on its
+    * own and then merged in, instead of inserted
+    * one item at a time
+    *******************************************/
+   template <class T, int N>
+   template <class Iterator>
+   void set<T, N>::insert(Iterator first, Iterator last)
+   {
+      set <T, N> setAdded(first, last);
+      if (numElements == 0)
       {
-         for(i = numElements; i > 0; i--)
-         {
-            if (data[i - 1] < element)
-            {
-               //This kicks it out at the point the element should be inserted
-               //data[i + 1] = data[i];
-               break;
-            }
-
-            data[i] = data[i-1];              
-
-         }
-         
-         data[i] = element;
-         numElements++;
-
+         adopt(setAdded);
+         return;
       }
 
-      // if(data[iInsert] == element && numElements == 0)
-      // {
-      //    numElements++;
-      // }
-      
-      
-      
-
-      
-
+      set <T, N> setMerged(*this || setAdded);
+      adopt(setMerged);
    }
 
    /********************************************
     * SET : ERASE
     * Find and erase an element from the set.
     *******************************************/
-   template <class T>
-   typename set <T>::iterator set<T>::erase(iterator it)
+   template <class T, int N>
+   typename set <T, N>::iterator set<T, N>::erase(iterator it)
    {
       T element = *it;
 
@@ -433,52 +482,259 @@ namespace custom
       
 /******************************************** PRIVATE FUNCTIONS DEFINITION ***/
 
+   /********************************************
+    * set : ADOPT
+    * Take over the buffer of another set, which
+    * is left empty. Items inside the other set
+    * can't be taken: they are copied
+    *******************************************/
+   template <class T, int N>
+   void set<T, N>::adopt(set <T, N> & rhs)
+   {
+      release();
+
+      if (rhs.isInline())
+      {
+         data = this->inlineData();
+         numCapacity = N;
+         for (int i = 0; i < rhs.numElements; i++)
+            data[i] = rhs.data[i];
+      }
+      else
+      {
+         data = rhs.data;
+         numCapacity = rhs.numCapacity;
+      }
+      numElements = rhs.numElements;
+
+      rhs.data = rhs.inlineData();
+      rhs.numElements = 0;
+      rhs.numCapacity = N;
+   }
+
+   /********************************************
+    * set : ALLOCATE
+    * Room for num items: the room inside the set
+    * if they fit there, otherwise the heap
+    *******************************************/
+   template <class T, int N>
+   T * set<T, N>::allocate(int num)
+   {
+      if (num <= N)
+         return this->inlineData();
+
+      try
+      {
+         return new T[num];
+      }
+      catch (...)
+      {
+         throw "ERROR: Unable to allocate a new buffer for set.";
+      }
+   }
+
+   /********************************************
+    * set : SORT
+    * Sort n items in place. Anything that can be
+    * compared is sorted with introsort
+    *******************************************/
+   template <class T>
+   inline void setSort(T * p, int n)
+   {
+      std::sort(p, p + n);
+   }
+
+   /********************************************
+    * set : SORT
+    * ints are sorted by their digits instead: a
+    * radix sort, one byte per pass, in O(n)
+    *******************************************/
+   inline void setSort(int * p, int n)
+   {
+      if (n < SET_RADIX_MIN)
+      {
+         std::sort(p, p + n);
+         return;
+      }
+
+      // flipping the sign bit makes the bytes sort like the ints
+      unsigned int * pFrom = (unsigned int *)p;
+      unsigned int * pTo;
+      try
+      {
+         pTo = new unsigned int[n];
+      }
+      catch (...)
+      {
+         throw "ERROR: Unable to allocate a new buffer for set.";
+      }
+      unsigned int * pBuffer = pTo;
+      for (int i = 0; i < n; i++)
+         pFrom[i] ^= 0x80000000u;
+
+      for (int shift = 0; shift < 32; shift += 8)
+      {
+         int count[257] = {};
+         for (int i = 0; i < n; i++)
+            count[((pFrom[i] >> shift) & 0xff) + 1]++;
+
+         // every item has the same byte here: nothing to move
+         if (count[((pFrom[0] >> shift) & 0xff) + 1] == n)
+            continue;
+
+         for (int digit = 0; digit < 256; digit++)
+            count[digit + 1] += count[digit];
+         for (int i = 0; i < n; i++)
+            pTo[count[(pFrom[i] >> shift) & 0xff]++] = pFrom[i];
+
+         unsigned int * pSwap = pFrom;
+         pFrom = pTo;
+         pTo = pSwap;
+      }
+
+      // the sorted items may have ended up in the other buffer
+      for (int i = 0; i < n; i++)
+         p[i] = (int)(pFrom[i] ^ 0x80000000u);
+      delete [] pBuffer;
+   }
+
+   /********************************************
+    * set : SORT UNIQUE
+    * Sort the items and squeeze out the
+    * duplicates in one pass. Returns how many
+    * are left
+    *******************************************/
+   template <class T, int N>
+   int set<T, N>::sortUnique()
+   {
+      setSort(data, numElements);
+
+      int numUnique = 0;
+      for (int i = 0; i < numElements; i++)
+         if (numUnique == 0 || !(data[numUnique - 1] == data[i]))
+            data[numUnique++] = data[i];
+      return numUnique;
+   }
+
    /********************************************
     * set : FIND INDEX
-    * Find index of existing element or where it
-    * should be inserted.
+    * Find index of existing element, or size()
+    * if it is not there
+    *******************************************/
+   template <class T, int N>
+   int set<T, N>::findIndex(const T & searchedElement) const
+   {
+      int index = lowerBound(searchedElement);
+      if (index < numElements && data[index] == searchedElement)
+         return index;
+      return numElements;
+   }
+
+   /********************************************
+    * set : COUNT LESS
+    * How many of n sorted items are less than t.
+    * Every item is compared, so there is no
+    * branch to mispredict
     *******************************************/
    template <class T>
-   int set<T>::findIndex(T searchedElement)
+   inline int setCountLess(const T * p, int n, const T & t)
    {
-      int indexBegin = 0;
-      int indexEnd = numElements - 1;
+      int count = 0;
+      for (int i = 0; i < n; i++)
+         count += (p[i] < t);
+      return count;
+   }
 
-      //modified binary search
-      while (indexBegin <= indexEnd)
-         {
-            //declaring inside the while loop makes it reset every time
-            int indexMiddle = (indexBegin + indexEnd) / 2;
-
-            //if found, return it
-            if (searchedElement == data[indexMiddle])
-            {   
-               //it always finds it in the middle
-               return indexMiddle;  
-            }
-            
-            //if searchedElement is lesser than, search first half
-            if (searchedElement < data[indexMiddle])
-            {
-               indexEnd = indexMiddle - 1;
-            }
-            //else, search second half
-            else
-            {
-               indexBegin = indexMiddle + 1;
-            }
+#ifdef __SSE2__
+   /********************************************
+    * set : COUNT LESS
+    * The same for int, comparing four at a time
+    *******************************************/
+   inline int setCountLess(const int * p, int n, const int & t)
+   {
+      __m128i key = _mm_set1_epi32(t);
+      __m128i count = _mm_setzero_si128();
+      int i = 0;
+      for (; i + 4 <= n; i += 4)
+      {
+         //a lane is -1 where the item is less than t
+         __m128i items = _mm_loadu_si128((const __m128i *)(p + i));
+         count = _mm_sub_epi32(count, _mm_cmplt_epi32(items, key));
+      }
+      count = _mm_add_epi32(count, _mm_shuffle_epi32(count, 0x4e));
+      count = _mm_add_epi32(count, _mm_shuffle_epi32(count, 0xb1));
+      int total = _mm_cvtsi128_si32(count);
+      for (; i < n; i++)
+         total += (p[i] < t);
+      return total;
+   }
+#endif
 
-         }
-      
-         return numElements; 
+   /********************************************
+    * set : LOWER BOUND
+    * Find the index of the first element not less
+    * than t: where it is or where it should be.
+    * The halving picks a side without branching,
+    * and the last block is counted in one go
+    *******************************************/
+   template <class T, int N>
+   int set<T, N>::lowerBound(const T & t) const
+   {
+      const T * base = data;
+      int n = numElements;
+
+      //the answer is always somewhere in [base, base + n]
+      while (n > SET_SEARCH_BLOCK)
+      {
+         int half = n / 2;
+         base = (base[half] < t) ? base + half : base;
+         n -= half;
+      }
+
+      return (base - data) + setCountLess(base, n, t);
+   }
+
+   /********************************************
+    * set : GALLOP
+    * Find the first item starting at iBegin that
+    * is not less than t: step 1, 2, 4, 8... items
+    * ahead until t is passed, then binary search
+    * that last step. Finding an item k slots away
+    * takes O(log k) comparisons
+    *******************************************/
+   template <class T, int N>
+   int set<T, N>::gallop(int iBegin, const T & t) const
+   {
+      int indexBegin = iBegin;
+      int indexEnd = iBegin;
+      int step = 1;
+      while (indexEnd < numElements && data[indexEnd] < t)
+      {
+         indexBegin = indexEnd + 1;
+         indexEnd = iBegin + step;
+         step *= 2;
+      }
+      if (indexEnd > numElements)
+         indexEnd = numElements;
+
+      //t is somewhere in [indexBegin, indexEnd]
+      while (indexBegin < indexEnd)
+      {
+         int indexMiddle = (indexBegin + indexEnd) / 2;
+         if (data[indexMiddle] < t)
+            indexBegin = indexMiddle + 1;
+         else
+            indexEnd = indexMiddle;
+      }
+      return indexBegin;
    }
 
    /********************************************
     * set : RESIZE
     * Dynamically resizes the vector
     *******************************************/
-   template <class T>
-   void set<T> ::resize(int newCapacity)
+   template <class T, int N>
+   void set<T, N> ::resize(int newCapacity)
    {
       // create a temporary pointer for array swap
       T* tempData = nullptr;
@@ -504,7 +760,8 @@ namespace custom
       for (int i = 0; i < numElements; i++)
          tempData[i] = data[i];
 
-      delete[] data;
+      //the room inside the set stays, but is not used anymore
+      release();
       
       //By copying the pointer, the nameless array in the heap is transferred 
       data = tempData;
@@ -521,8 +778,8 @@ namespace custom
     * An iterator through the internal array of 
     * the set
     *************************************************/
-   template <class T>
-   class set <T> :: iterator
+   template <class T, int N>
+   class set <T, N> :: iterator
    {
    public:
       // constructors, destructors, and assignment operator
@@ -583,8 +840,8 @@ namespace custom
     * Note that you have to use "typename" before
     * the return value type
     ********************************************/
-   template <class T>
-   typename set <T> ::iterator set <T> ::end()
+   template <class T, int N>
+   typename set <T, N> ::iterator set <T, N> ::end()
    {
       return iterator(data + numElements);
    }
@@ -594,8 +851,8 @@ namespace custom
     * A constant iterator through the internal array of
     * the set
     *************************************************/
-   template <class T>
-   class set <T> ::const_iterator
+   template <class T, int N>
+   class set <T, N> ::const_iterator
    {
    public:
       // constructors, destructors, and assignment operator
@@ -655,8 +912,8 @@ namespace custom
     * Note that you have to use "typename" before
     * the return value type
     ********************************************/
-   template <class T>
-   typename set <T> ::const_iterator set <T> ::cend() const //had to make a promise to compiler
+   template <class T, int N>
+   typename set <T, N> ::const_iterator set <T, N> ::cend() const //had to make a promise to compiler
    {
       return const_iterator(data + numElements);
    }
@@ -0,0 +1,80 @@
+/***********************************************************************
+* Header:
+*    SMALL BUFFER
+* Summary:
+*    This class contains the room a container keeps inside itself for
+*    its first few items, so a container that stays small never
+*    allocates anything.
+*    Of particular interest is the empty case: with no room at all it
+*    has no members, and a container inheriting from it gets no bigger.
+*
+*    This will contain the class definition of:
+*       SmallBuffer <T, N>  : room for N items of T
+*       RawBuffer <T, N>    : room for N items of T, not yet constructed
+* Author
+*    Daniel Perez, Jamie Hurd, Benjamin Dyas
+************************************************************************/
+#ifndef SMALL_BUFFER_H
+#define SMALL_BUFFER_H
+
+namespace custom
+{
+   /************************************************
+    * SMALL BUFFER
+    * Room for N items. The containers inherit from
+    * it and point at it until they outgrow it
+    ***********************************************/
+   template <class T, int N>
+   class SmallBuffer
+   {
+   protected:
+            T * inlineData()       { return items; }
+      const T * inlineData() const { return items; }
+
+   private:
+      T items[N];
+   };
+
+   /************************************************
+    * SMALL BUFFER
+    * No room at all: everything is on the heap
+    ***********************************************/
+   template <class T>
+   class SmallBuffer <T, 0>
+   {
+   protected:
+            T * inlineData()       { return nullptr; }
+      const T * inlineData() const { return nullptr; }
+   };
+
+   /************************************************
+    * RAW BUFFER
+    * Room for N items that are not constructed
+    * until the container puts them there, for a
+    * container that constructs its items in place
+    ***********************************************/
+   template <class T, int N>
+   class RawBuffer
+   {
+   protected:
+            T * inlineData()       { return reinterpret_cast <T *> (bytes); }
+      const T * inlineData() const { return reinterpret_cast <const T *> (bytes); }
+
+   private:
+      alignas(T) unsigned char bytes[N * sizeof(T)];
+   };
+
+   /************************************************
+    * RAW BUFFER
+    * No room at all: everything is on the heap
+    ***********************************************/
+   template <class T>
+   class RawBuffer <T, 0>
+   {
+   protected:
+            T * inlineData()       { return nullptr; }
+      const T * inlineData() const { return nullptr; }
+   };
+}; //end namespace custom
+
+#endif // SMALL_BUFFER_H
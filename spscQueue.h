@@ -0,0 +1,242 @@
+/***********************************************************************
+* Header:
+*    SPSC QUEUE
+* Summary:
+*    This class contains the notion of a queue shared by two threads:
+*    one thread only pushes and the other one only pops, so items can
+*    be handed from one stage of a pipeline to the next without a lock.
+*    Of particular interest is what each side writes: the producer
+*    only ever writes the tail and the consumer only ever writes the
+*    head. Each lives on its own cache line, next to the copy of the
+*    other one that its thread last saw, so the two threads only touch
+*    each other's line when the queue looks full or empty.
+*
+*    This will contain the class definition of:
+*       spscQueue              : a bounded single producer, single
+*                                consumer queue
+* Author
+*    Benjamin Dyas, Daniel Perez
+************************************************************************/
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <new>          // for BAD_ALLOC
+#include <utility>      // for MOVE
+
+#ifndef CACHE_LINE_SIZE
+#define CACHE_LINE_SIZE 64
+#endif
+
+namespace custom
+{
+   /************************************************
+    * SPSC QUEUE
+    * A fixed size ring buffer. push() may only be
+    * called by one thread and pop() by one other
+    * thread. Neither ever waits: they say when the
+    * queue is full or empty instead
+    ***********************************************/
+   template <class T>
+   class spscQueue
+   {
+   public:
+      // constructors, destructors
+      explicit spscQueue(int numCapacity);
+      spscQueue(const spscQueue & rhs) = delete;
+      spscQueue & operator = (const spscQueue & rhs) = delete;
+      ~spscQueue() { delete [] data; }
+
+      // container interfaces. Another thread may change the size at
+      //    any moment, so it is only a snapshot
+      int   size()      const { return (int)(tail.load(std::memory_order_acquire) -
+                                             head.load(std::memory_order_acquire)); }
+      int   capacity()  const { return (int)(mask + 1); }
+      bool  empty()     const { return size() == 0; }
+
+      // the producer's side: false, or 0 items, when the queue is full
+      bool  push(const T & element);
+      bool  push(T && element);
+      int   push(const T * elements, int num);
+
+      // the consumer's side: false, or 0 items, when the queue is empty
+      bool  pop(T & element);
+      int   pop(T * elements, int num);
+
+   private:
+      // read only once built: shared by both threads without a cost
+      T * data;
+      unsigned int mask;        // the capacity, a power of two, minus one
+
+      // written by the producer
+      alignas(CACHE_LINE_SIZE) std::atomic <unsigned int> tail;
+      unsigned int headCache;   // the head the producer last saw
+
+      // written by the consumer
+      alignas(CACHE_LINE_SIZE) std::atomic <unsigned int> head;
+      unsigned int tailCache;   // the tail the consumer last saw
+
+      // nothing else on the consumer's line
+      char padding[CACHE_LINE_SIZE - sizeof(std::atomic <unsigned int>) -
+                   sizeof(unsigned int)];
+
+      // how many can go in or come out, looking again if fewer than num
+      int  room(int num = 1);
+      int  available(int num = 1);
+   };
+
+   /**********************************************
+    * SPSC QUEUE : NON-DEFAULT CONSTRUCTOR
+    * Allocate the array to "numCapacity", rounded
+    * up to a power of two
+    **********************************************/
+   template <class T>
+   spscQueue<T>::spscQueue(int numCapacity) :
+      data(nullptr), mask(0), tail(0), headCache(0), head(0), tailCache(0)
+   {
+      unsigned int capacity = 1;
+      while ((int)capacity < numCapacity)
+         capacity *= 2;
+
+      try
+      {
+         data = new T[capacity];
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: Unable to allocate a new buffer for spscQueue";
+      }
+      mask = capacity - 1;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : ROOM
+    * How many items the producer can push. The
+    * consumer's head is only read when the copy of
+    * it says there is room for fewer than num
+    **********************************************/
+   template <class T>
+   int spscQueue<T>::room(int num)
+   {
+      unsigned int t = tail.load(std::memory_order_relaxed);
+      int numRoom = (int)(mask + 1 - (t - headCache));
+      if (numRoom < num)
+      {
+         headCache = head.load(std::memory_order_acquire);
+         numRoom = (int)(mask + 1 - (t - headCache));
+      }
+      return numRoom;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : AVAILABLE
+    * How many items the consumer can pop. The
+    * producer's tail is only read when the copy of
+    * it says there are fewer than num
+    **********************************************/
+   template <class T>
+   int spscQueue<T>::available(int num)
+   {
+      unsigned int h = head.load(std::memory_order_relaxed);
+      int numAvailable = (int)(tailCache - h);
+      if (numAvailable < num)
+      {
+         tailCache = tail.load(std::memory_order_acquire);
+         numAvailable = (int)(tailCache - h);
+      }
+      return numAvailable;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : PUSH
+    * The item is written before the tail moves
+    * past it: release makes sure the consumer sees
+    * it in that order
+    **********************************************/
+   template <class T>
+   bool spscQueue<T>::push(const T & element)
+   {
+      if (room() == 0)
+         return false;
+
+      unsigned int t = tail.load(std::memory_order_relaxed);
+      data[t & mask] = element;
+      tail.store(t + 1, std::memory_order_release);
+      return true;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : PUSH
+    * The same, moving the item in
+    **********************************************/
+   template <class T>
+   bool spscQueue<T>::push(T && element)
+   {
+      if (room() == 0)
+         return false;
+
+      unsigned int t = tail.load(std::memory_order_relaxed);
+      data[t & mask] = std::move(element);
+      tail.store(t + 1, std::memory_order_release);
+      return true;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : PUSH (BATCH)
+    * Push as many of num items as there is room
+    * for, moving the tail once for all of them.
+    * Returns how many were pushed
+    **********************************************/
+   template <class T>
+   int spscQueue<T>::push(const T * elements, int num)
+   {
+      int numRoom = room(num);
+      if (num > numRoom)
+         num = numRoom;
+
+      unsigned int t = tail.load(std::memory_order_relaxed);
+      for (int i = 0; i < num; i++)
+         data[(t + i) & mask] = elements[i];
+      tail.store(t + num, std::memory_order_release);
+      return num;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : POP
+    * The item is read before the head moves past
+    * it: release makes sure the producer does not
+    * write over it too early
+    **********************************************/
+   template <class T>
+   bool spscQueue<T>::pop(T & element)
+   {
+      if (available() == 0)
+         return false;
+
+      unsigned int h = head.load(std::memory_order_relaxed);
+      element = std::move(data[h & mask]);
+      head.store(h + 1, std::memory_order_release);
+      return true;
+   }
+
+   /**********************************************
+    * SPSC QUEUE : POP (BATCH)
+    * Pop up to num items, moving the head once
+    * for all of them. Returns how many were popped
+    **********************************************/
+   template <class T>
+   int spscQueue<T>::pop(T * elements, int num)
+   {
+      int numAvailable = available(num);
+      if (num > numAvailable)
+         num = numAvailable;
+
+      unsigned int h = head.load(std::memory_order_relaxed);
+      for (int i = 0; i < num; i++)
+         elements[i] = std::move(data[(h + i) & mask]);
+      head.store(h + num, std::memory_order_release);
+      return num;
+   }
+}; //end namespace custom
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,691 @@
+/***********************************************************************
+* Header:
+*    SWISS TABLE
+* Summary:
+*    This class contains a hash set and a hash map that keep their
+*    values right in the table, like Hash, but look for them sixteen
+*    slots at a time. Next to every slot is one control byte: empty,
+*    deleted, or seven bits of the hash of the key in it. A search
+*    compares its seven bits against a whole group of sixteen control
+*    bytes in one SSE2 instruction, and only the few slots that match
+*    have their keys compared. Most lookups for a key that is not
+*    there never compare a key at all.
+*    Of particular interest is erase: a slot in a group that was ever
+*    full is marked deleted (a tombstone) rather than empty, so the
+*    searches that went past that group still do.
+*
+*    This will contain the class definition of:
+*       swissTable <K, Slot, KeyOf, Hasher> : the table the two share
+*       flatSet <K, Hasher>                 : a set of unique keys
+*       flatMap <K, V, Hasher>              : a map from key to value
+* Author
+*    Daniel Perez, Jamie Hurd, Benjamin Dyas
+************************************************************************/
+#ifndef SWISS_TABLE_H
+#define SWISS_TABLE_H
+
+#include <new>          // for BAD_ALLOC
+#include <utility>      // for MOVE
+#include "hash.h"       // for HASHER
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// the slots a search looks at in one go
+#define SWISS_GROUP_SIZE 16
+
+// control bytes. A full slot has the low seven bits of its hash, 0 ... 127
+#define SWISS_EMPTY   ((signed char)-128)
+#define SWISS_DELETED ((signed char)-2)
+
+namespace custom
+{
+   /**********************************************
+    * SWISS MATCH
+    * Bit i is set where control byte i of the
+    * group is b
+    **********************************************/
+   inline unsigned int swissMatch(const signed char * group, signed char b)
+   {
+#ifdef __SSE2__
+      __m128i bytes = _mm_loadu_si128((const __m128i *)group);
+      return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(b)));
+#else
+      unsigned int match = 0;
+      for (int i = 0; i < SWISS_GROUP_SIZE; i++)
+         match |= (unsigned int)(group[i] == b) << i;
+      return match;
+#endif
+   }
+
+   /**********************************************
+    * SWISS MATCH FREE
+    * Bit i is set where slot i of the group is
+    * empty or deleted: the only control bytes
+    * with the sign bit set
+    **********************************************/
+   inline unsigned int swissMatchFree(const signed char * group)
+   {
+#ifdef __SSE2__
+      return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)group));
+#else
+      unsigned int match = 0;
+      for (int i = 0; i < SWISS_GROUP_SIZE; i++)
+         match |= (unsigned int)(group[i] < 0) << i;
+      return match;
+#endif
+   }
+
+   /************************************************
+    * SWISS TABLE
+    * Slots of type Slot, each holding a key of type
+    * K that KeyOf finds. Hasher is one of hash.h's:
+    * a full unsigned hash of the key. Lookups take
+    * anything Hasher can hash and K compares equal
+    * with, such as a string_view for a string
+    ***********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   class swissTable
+   {
+   public:
+      // constructors, destructors
+      swissTable() : ctrl(nullptr), slots(nullptr), numElements(0),
+                     numGroups(0), numGrowth(0) {}
+      swissTable(const Hasher & hasher) : swissTable() { this->hasher = hasher; }
+      swissTable(const swissTable & rhs) : swissTable() { *this = rhs; }
+      ~swissTable() { release(); }
+
+      // overloaded operators
+      swissTable & operator = (const swissTable & rhs);
+
+      // container interfaces
+      int   size()      const { return numElements; }
+      int   capacity()  const { return numGroups * SWISS_GROUP_SIZE; }
+      bool  empty()     const { return numElements == 0; }
+      void  clear();
+      void  reserve(int num);
+
+      // iterators
+      class iterator;
+      iterator begin()      { return iterator(ctrl, slots, ctrl + capacity()); }
+      iterator end()        { return iterator(ctrl + capacity(), nullptr, ctrl + capacity()); }
+
+      class const_iterator;
+      const_iterator cbegin() const { return const_iterator(ctrl, slots, ctrl + capacity()); }
+      const_iterator cend()   const { return const_iterator(ctrl + capacity(), nullptr, ctrl + capacity()); }
+
+      // table specific
+      template <class Q>
+      iterator       find(const Q & key);
+      template <class Q>
+      const_iterator find(const Q & key) const;
+      template <class Q>
+      bool           contains(const Q & key) const { return findIndex(key, hasher(key)) != -1; }
+      template <class Q>
+      bool           erase(const Q & key);
+
+   protected:
+      // the slot of key, added if it is not there yet
+      int insertIndex(const K & key, bool & isNew);
+      Slot & slot(int i) { return slots[i]; }
+
+   private:
+      signed char * ctrl;       // one control byte per slot
+      Slot * slots;
+      int numElements;
+      int numGroups;            // a power of two
+      int numGrowth;            // empty slots that may still be filled
+      Hasher hasher;
+
+      template <class Q>
+      int  findIndex(const Q & key, unsigned int h) const;
+      int  freeIndex(unsigned int h) const;
+      void eraseIndex(int i);
+      void rehash(int numGroupsNew);
+      void release();
+
+      // the top bits pick the first group, the low seven go in the control byte
+      int  firstGroup(unsigned int h) const { return (int)((h >> 7) & (unsigned int)(numGroups - 1)); }
+      static signed char fingerprint(unsigned int h) { return (signed char)(h & 0x7f); }
+
+      // at most seven eighths full, so every search finds an empty slot
+      static int maxLoad(int numCapacity) { return numCapacity - numCapacity / 8; }
+   };
+
+   /**************************************************
+    * SWISS TABLE ITERATOR
+    * Goes through the full slots in table order.
+    * The key of a slot must not be changed
+    *************************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   class swissTable <K, Slot, KeyOf, Hasher> :: iterator
+   {
+   public:
+      iterator() : pCtrl(nullptr), pSlot(nullptr), pEnd(nullptr) {}
+      iterator(signed char * pCtrl, Slot * pSlot, signed char * pEnd) :
+         pCtrl(pCtrl), pSlot(pSlot), pEnd(pEnd) { skip(); }
+
+      bool operator == (const iterator & rhs) const { return pCtrl == rhs.pCtrl; }
+      bool operator != (const iterator & rhs) const { return pCtrl != rhs.pCtrl; }
+
+      Slot & operator * ()  const { return *pSlot; }
+      Slot * operator -> () const { return pSlot;  }
+
+      iterator & operator ++ ()
+      {
+         ++pCtrl;
+         ++pSlot;
+         skip();
+         return *this;
+      }
+      iterator operator ++ (int)
+      {
+         iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+   private:
+      signed char * pCtrl;
+      Slot * pSlot;
+      signed char * pEnd;
+
+      void skip()
+      {
+         while (pCtrl != pEnd && *pCtrl < 0)
+         {
+            ++pCtrl;
+            ++pSlot;
+         }
+      }
+
+      friend class const_iterator;
+   };
+
+   /**************************************************
+    * SWISS TABLE CONST ITERATOR
+    *************************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   class swissTable <K, Slot, KeyOf, Hasher> :: const_iterator
+   {
+   public:
+      const_iterator() : pCtrl(nullptr), pSlot(nullptr), pEnd(nullptr) {}
+      const_iterator(const signed char * pCtrl, const Slot * pSlot, const signed char * pEnd) :
+         pCtrl(pCtrl), pSlot(pSlot), pEnd(pEnd) { skip(); }
+      const_iterator(const iterator & rhs) :
+         pCtrl(rhs.pCtrl), pSlot(rhs.pSlot), pEnd(rhs.pEnd) {}
+
+      bool operator == (const const_iterator & rhs) const { return pCtrl == rhs.pCtrl; }
+      bool operator != (const const_iterator & rhs) const { return pCtrl != rhs.pCtrl; }
+
+      const Slot & operator * ()  const { return *pSlot; }
+      const Slot * operator -> () const { return pSlot;  }
+
+      const_iterator & operator ++ ()
+      {
+         ++pCtrl;
+         ++pSlot;
+         skip();
+         return *this;
+      }
+      const_iterator operator ++ (int)
+      {
+         const_iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+   private:
+      const signed char * pCtrl;
+      const Slot * pSlot;
+      const signed char * pEnd;
+
+      void skip()
+      {
+         while (pCtrl != pEnd && *pCtrl < 0)
+         {
+            ++pCtrl;
+            ++pSlot;
+         }
+      }
+   };
+
+   /**********************************************
+    * SWISS TABLE : ASSIGNMENT OPERATOR
+    * The same groups and the same layout as rhs
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   swissTable <K, Slot, KeyOf, Hasher> &
+   swissTable <K, Slot, KeyOf, Hasher> :: operator = (const swissTable & rhs)
+   {
+      if (this == &rhs)
+         return *this;
+
+      int numCapacity = rhs.capacity();
+      signed char * ctrlNew = nullptr;
+      Slot * slotsNew = nullptr;
+      if (numCapacity > 0)
+      {
+         try
+         {
+            ctrlNew = new signed char[numCapacity];
+            slotsNew = new Slot[numCapacity]();
+         }
+         catch (std::bad_alloc &)
+         {
+            delete [] ctrlNew;
+            throw "ERROR: Unable to allocate a new buffer for swissTable";
+         }
+         for (int i = 0; i < numCapacity; i++)
+         {
+            ctrlNew[i] = rhs.ctrl[i];
+            if (rhs.ctrl[i] >= 0)
+               slotsNew[i] = rhs.slots[i];
+         }
+      }
+
+      release();
+      ctrl = ctrlNew;
+      slots = slotsNew;
+      numElements = rhs.numElements;
+      numGroups = rhs.numGroups;
+      numGrowth = rhs.numGrowth;
+      hasher = rhs.hasher;
+      return *this;
+   }
+
+   /**********************************************
+    * SWISS TABLE : CLEAR
+    * Keep the groups, let go of what the slots hold
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   void swissTable <K, Slot, KeyOf, Hasher> :: clear()
+   {
+      for (int i = 0; i < capacity(); i++)
+      {
+         if (ctrl[i] >= 0)
+            slots[i] = Slot();
+         ctrl[i] = SWISS_EMPTY;
+      }
+      numElements = 0;
+      numGrowth = maxLoad(capacity());
+   }
+
+   /**********************************************
+    * SWISS TABLE : RESERVE
+    * Room for num keys without another rehash
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   void swissTable <K, Slot, KeyOf, Hasher> :: reserve(int num)
+   {
+      if (num <= numElements + numGrowth)
+         return;
+
+      int numGroupsNew = (numGroups == 0 ? 1 : numGroups);
+      while (maxLoad(numGroupsNew * SWISS_GROUP_SIZE) < num)
+         numGroupsNew *= 2;
+      rehash(numGroupsNew);
+   }
+
+   /**********************************************
+    * SWISS TABLE : FIND
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   template <class Q>
+   typename swissTable <K, Slot, KeyOf, Hasher> :: iterator
+   swissTable <K, Slot, KeyOf, Hasher> :: find(const Q & key)
+   {
+      int i = findIndex(key, hasher(key));
+      if (i == -1)
+         return end();
+      return iterator(ctrl + i, slots + i, ctrl + capacity());
+   }
+
+   template <class K, class Slot, class KeyOf, class Hasher>
+   template <class Q>
+   typename swissTable <K, Slot, KeyOf, Hasher> :: const_iterator
+   swissTable <K, Slot, KeyOf, Hasher> :: find(const Q & key) const
+   {
+      int i = findIndex(key, hasher(key));
+      if (i == -1)
+         return cend();
+      return const_iterator(ctrl + i, slots + i, ctrl + capacity());
+   }
+
+   /**********************************************
+    * SWISS TABLE : ERASE
+    * Returns whether key was there to erase
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   template <class Q>
+   bool swissTable <K, Slot, KeyOf, Hasher> :: erase(const Q & key)
+   {
+      int i = findIndex(key, hasher(key));
+      if (i == -1)
+         return false;
+      eraseIndex(i);
+      return true;
+   }
+
+   /**********************************************
+    * SWISS TABLE : INSERT INDEX
+    * The key goes in the slot before the control
+    * byte says it is full, so a key that throws
+    * while being copied leaves the table as it was
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   int swissTable <K, Slot, KeyOf, Hasher> :: insertIndex(const K & key, bool & isNew)
+   {
+      unsigned int h = hasher(key);
+      int i = findIndex(key, h);
+      isNew = (i == -1);
+      if (!isNew)
+         return i;
+
+      // out of empty slots: twice the groups, unless tombstones are
+      //    most of what fills them
+      if (numGrowth == 0)
+      {
+         if (numGroups > 0 && 2 * numElements < maxLoad(capacity()))
+            rehash(numGroups);
+         else
+            rehash(numGroups == 0 ? 1 : numGroups * 2);
+      }
+
+      i = freeIndex(h);
+      KeyOf::key(slots[i]) = key;
+      if (ctrl[i] == SWISS_EMPTY)
+         numGrowth--;
+      ctrl[i] = fingerprint(h);
+      numElements++;
+      return i;
+   }
+
+   /**********************************************
+    * SWISS TABLE : FIND INDEX
+    * Visit the groups 0, 1, 3, 6, 10 ... past the
+    * first, which with a power of two of them
+    * reaches each one once. Only the slots whose
+    * control byte matches have their key compared.
+    * A group with an empty slot was never full, so
+    * nothing was ever pushed past it
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   template <class Q>
+   int swissTable <K, Slot, KeyOf, Hasher> :: findIndex(const Q & key, unsigned int h) const
+   {
+      if (numGroups == 0)
+         return -1;
+
+      int group = firstGroup(h);
+      for (int probe = 1; ; probe++)
+      {
+         const signed char * pGroup = ctrl + group * SWISS_GROUP_SIZE;
+         for (unsigned int match = swissMatch(pGroup, fingerprint(h)); match; match &= match - 1)
+         {
+            int i = group * SWISS_GROUP_SIZE + __builtin_ctz(match);
+            if (KeyOf::key(slots[i]) == key)
+               return i;
+         }
+         if (swissMatch(pGroup, SWISS_EMPTY))
+            return -1;
+         group = (group + probe) & (numGroups - 1);
+      }
+   }
+
+   /**********************************************
+    * SWISS TABLE : FREE INDEX
+    * The first empty or deleted slot along the
+    * same groups a search for h would visit
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   int swissTable <K, Slot, KeyOf, Hasher> :: freeIndex(unsigned int h) const
+   {
+      int group = firstGroup(h);
+      for (int probe = 1; ; probe++)
+      {
+         unsigned int match = swissMatchFree(ctrl + group * SWISS_GROUP_SIZE);
+         if (match)
+            return group * SWISS_GROUP_SIZE + __builtin_ctz(match);
+         group = (group + probe) & (numGroups - 1);
+      }
+   }
+
+   /**********************************************
+    * SWISS TABLE : ERASE INDEX
+    * A group that still has an empty slot was
+    * never full, so no search goes past it and
+    * the slot can be empty again. Otherwise it
+    * becomes a tombstone: searches go on past it
+    * and inserts fill it
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   void swissTable <K, Slot, KeyOf, Hasher> :: eraseIndex(int i)
+   {
+      slots[i] = Slot();
+      const signed char * pGroup = ctrl + (i - i % SWISS_GROUP_SIZE);
+      if (swissMatch(pGroup, SWISS_EMPTY))
+      {
+         ctrl[i] = SWISS_EMPTY;
+         numGrowth++;
+      }
+      else
+         ctrl[i] = SWISS_DELETED;
+      numElements--;
+   }
+
+   /**********************************************
+    * SWISS TABLE : REHASH
+    * Every key moved into numGroupsNew groups.
+    * The tombstones are left behind
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   void swissTable <K, Slot, KeyOf, Hasher> :: rehash(int numGroupsNew)
+   {
+      int numCapacityNew = numGroupsNew * SWISS_GROUP_SIZE;
+      signed char * ctrlNew = nullptr;
+      Slot * slotsNew = nullptr;
+      try
+      {
+         ctrlNew = new signed char[numCapacityNew];
+         slotsNew = new Slot[numCapacityNew]();
+      }
+      catch (std::bad_alloc &)
+      {
+         delete [] ctrlNew;
+         throw "ERROR: Unable to allocate a new buffer for swissTable";
+      }
+      for (int i = 0; i < numCapacityNew; i++)
+         ctrlNew[i] = SWISS_EMPTY;
+
+      signed char * ctrlOld = ctrl;
+      Slot * slotsOld = slots;
+      int numCapacityOld = capacity();
+      ctrl = ctrlNew;
+      slots = slotsNew;
+      numGroups = numGroupsNew;
+
+      for (int i = 0; i < numCapacityOld; i++)
+         if (ctrlOld[i] >= 0)
+         {
+            int j = freeIndex(hasher(KeyOf::key(slotsOld[i])));
+            slots[j] = std::move(slotsOld[i]);
+            ctrl[j] = ctrlOld[i];
+         }
+      numGrowth = maxLoad(numCapacityNew) - numElements;
+
+      delete [] ctrlOld;
+      delete [] slotsOld;
+   }
+
+   /**********************************************
+    * SWISS TABLE : RELEASE
+    **********************************************/
+   template <class K, class Slot, class KeyOf, class Hasher>
+   void swissTable <K, Slot, KeyOf, Hasher> :: release()
+   {
+      delete [] ctrl;
+      delete [] slots;
+      ctrl = nullptr;
+      slots = nullptr;
+      numElements = 0;
+      numGroups = 0;
+      numGrowth = 0;
+   }
+/********************************************************** SET & MAP ***/
+
+   // a set's slot is the key itself
+   template <class K>
+   struct SetKey
+   {
+      static K &       key(K & slot)       { return slot; }
+      static const K & key(const K & slot) { return slot; }
+   };
+
+   /************************************************
+    * FLAT SET
+    * The keys are handed out as const: changing one
+    * would lose it in the table
+    ***********************************************/
+   template <class K, class Hasher = hasher <K> >
+   class flatSet : public swissTable <K, K, SetKey <K>, Hasher>
+   {
+      typedef swissTable <K, K, SetKey <K>, Hasher> Table;
+
+   public:
+      flatSet() {}
+      flatSet(const Hasher & hasher) : Table(hasher) {}
+
+      typedef typename Table::const_iterator iterator;
+      iterator begin() const { return this->cbegin(); }
+      iterator end()   const { return this->cend();   }
+
+      template <class Q>
+      iterator find(const Q & key) const { return Table::find(key); }
+
+      // returns whether key was not there already
+      bool insert(const K & key)
+      {
+         bool isNew;
+         this->insertIndex(key, isNew);
+         return isNew;
+      }
+   };
+
+   // a map's slot is a key and its value
+   template <class K, class V>
+   struct MapEntry
+   {
+      K key;
+      V value;
+   };
+
+   template <class K, class V>
+   struct MapKey
+   {
+      static K &       key(MapEntry <K, V> & slot)       { return slot.key; }
+      static const K & key(const MapEntry <K, V> & slot) { return slot.key; }
+   };
+
+   // what a map's iterator gives: the key, which may not be changed, and
+   //    the value, which may
+   template <class K, class V>
+   struct MapRef
+   {
+      const K & key;
+      V & value;
+   };
+
+   /**************************************************
+    * MAP ITERATOR
+    * A table iterator that hands out a MapRef
+    * instead of the MapEntry itself
+    *************************************************/
+   template <class TableIterator, class K, class V>
+   class mapIterator
+   {
+   public:
+      mapIterator() {}
+      mapIterator(const TableIterator & it) : it(it) {}
+      template <class I, class U>
+      mapIterator(const mapIterator <I, K, U> & rhs) : it(rhs.it) {}
+
+      bool operator == (const mapIterator & rhs) const { return it == rhs.it; }
+      bool operator != (const mapIterator & rhs) const { return it != rhs.it; }
+
+      MapRef <K, V> operator * () const { return MapRef <K, V> { it->key, it->value }; }
+
+      // it->value: the MapRef has to live as long as the expression
+      struct Arrow
+      {
+         MapRef <K, V> ref;
+         const MapRef <K, V> * operator -> () const { return &ref; }
+      };
+      Arrow operator -> () const { return Arrow { **this }; }
+
+      mapIterator & operator ++ ()
+      {
+         ++it;
+         return *this;
+      }
+      mapIterator operator ++ (int)
+      {
+         mapIterator tmp(*this);
+         ++it;
+         return tmp;
+      }
+
+   private:
+      TableIterator it;
+
+      template <class I, class KK, class U>
+      friend class mapIterator;
+   };
+
+   /************************************************
+    * FLAT MAP
+    * Iterators give a MapRef: the value may be
+    * changed through it, the key may not
+    ***********************************************/
+   template <class K, class V, class Hasher = hasher <K> >
+   class flatMap : public swissTable <K, MapEntry <K, V>, MapKey <K, V>, Hasher>
+   {
+      typedef swissTable <K, MapEntry <K, V>, MapKey <K, V>, Hasher> Table;
+
+   public:
+      flatMap() {}
+      flatMap(const Hasher & hasher) : Table(hasher) {}
+
+      typedef mapIterator <typename Table::iterator, K, V>             iterator;
+      typedef mapIterator <typename Table::const_iterator, K, const V> const_iterator;
+      iterator       begin()        { return Table::begin();  }
+      iterator       end()          { return Table::end();    }
+      const_iterator cbegin() const { return Table::cbegin(); }
+      const_iterator cend()   const { return Table::cend();   }
+
+      template <class Q>
+      iterator       find(const Q & key)       { return Table::find(key); }
+      template <class Q>
+      const_iterator find(const Q & key) const { return Table::find(key); }
+
+      // the value of key, a default one if key was not there
+      V & operator [] (const K & key)
+      {
+         bool isNew;
+         return this->slot(this->insertIndex(key, isNew)).value;
+      }
+
+      // returns whether key was not there already; if it was, its
+      //    value is left alone
+      bool insert(const K & key, const V & value)
+      {
+         bool isNew;
+         int i = this->insertIndex(key, isNew);
+         if (isNew)
+            this->slot(i).value = value;
+         return isNew;
+      }
+   };
+}; //end namespace custom
+
+#endif // SWISS_TABLE_H
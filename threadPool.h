@@ -0,0 +1,629 @@
+/***********************************************************************
+* Header:
+*    THREAD POOL
+* Summary:
+*    This class contains a pool of worker threads that share out the
+*    parts of a job, such as the halves of a range or the independent
+*    pieces of a set operation, so every core has something to do.
+*    Of particular interest is where the tasks are kept: every worker
+*    has its own deque. It pushes and takes the tasks it makes at the
+*    bottom, newest first, with no compare and swap in the common case.
+*    A worker with nothing to do steals the oldest task from the top of
+*    another worker's deque. Old tasks are the big ones near the root
+*    of the job, so one steal hands over plenty of work.
+*
+*    This will contain the class definition of:
+*       workDeque              : a Chase-Lev work stealing deque
+*       threadPool             : the worker threads
+*       taskGroup              : tasks that can be waited for together
+*       parallelFor            : run a function on every index of a range
+*       parallelInvoke         : run two functions at the same time
+* Author
+*    Benjamin Dyas, Daniel Perez, Jamie Hurd
+************************************************************************/
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <new>          // for BAD_ALLOC
+#include <thread>
+#include "mpmcQueue.h"
+
+// room for the tasks threads outside the pool hand to it
+#define POOL_QUEUE_SIZE 4096
+
+// how many times an idle worker looks for a task before it sleeps
+#define POOL_SPIN_LIMIT 64
+
+namespace custom
+{
+   class taskGroup;
+
+   /************************************************
+    * TASK
+    * One piece of work, and the group waiting for it
+    ***********************************************/
+   struct Task
+   {
+      std::function <void ()> work;
+      taskGroup * pGroup;
+   };
+
+   /************************************************
+    * WORK DEQUE
+    * The owner pushes and takes at the bottom, any
+    * other thread steals at the top. The array
+    * doubles when full. An old array may still be
+    * read by a thief, so it is kept until the end
+    ***********************************************/
+   class workDeque
+   {
+   public:
+      workDeque();
+      workDeque(const workDeque & rhs) = delete;
+      workDeque & operator = (const workDeque & rhs) = delete;
+      ~workDeque();
+
+      // the owner only
+      void   push(Task * pTask);
+      Task * take();
+
+      // any thread. nullptr when it is empty, or another thread won
+      Task * steal();
+
+   private:
+      struct Array
+      {
+         long numCapacity;
+         std::atomic <Task *> * tasks;
+         Array * pOlder;         // the array this one replaced
+
+         Task * get(long i) const
+         {
+            return tasks[i & (numCapacity - 1)].load(std::memory_order_relaxed);
+         }
+         void put(long i, Task * pTask)
+         {
+            tasks[i & (numCapacity - 1)].store(pTask, std::memory_order_relaxed);
+         }
+      };
+
+      alignas(CACHE_LINE_SIZE) std::atomic <long> top;     // thieves
+      alignas(CACHE_LINE_SIZE) std::atomic <long> bottom;  // the owner
+      std::atomic <Array *> array;
+
+      static Array * newArray(long numCapacity);
+      Array * grow(Array * pArray, long iBottom, long iTop);
+   };
+
+   /************************************************
+    * THREAD POOL
+    * The workers, and the queue for the tasks that
+    * come from threads outside the pool
+    ***********************************************/
+   class threadPool
+   {
+   public:
+      explicit threadPool(int numThreads = 0);
+      threadPool(const threadPool & rhs) = delete;
+      threadPool & operator = (const threadPool & rhs) = delete;
+      ~threadPool();
+
+      int   size() const { return numWorkers; }
+
+   private:
+      struct Worker
+      {
+         workDeque tasks;
+         std::thread thread;
+         unsigned int seed;      // for picking whom to steal from
+      };
+
+      Worker ** workers;
+      int numWorkers;
+      mpmcQueue <Task *> incoming;
+
+      // sleeping until there is work
+      std::atomic <int> numQueued;
+      std::atomic <int> numSleeping;
+      std::atomic <bool> isDone;
+      std::mutex mutex;
+      std::condition_variable wakeUp;
+
+      friend class taskGroup;
+      void   schedule(Task * pTask);
+      bool   runOne();
+      Task * findTask(Worker * pSelf);
+      void   run(Worker * pSelf);
+      void   sleep();
+
+      // the worker this thread is, if it is one of this pool's
+      Worker * currentWorker() const;
+      static Worker *& current();
+      static const threadPool *& currentPool();
+   };
+
+   /************************************************
+    * TASK GROUP
+    * Fork: run() hands a task to the pool. Join:
+    * wait() helps with any task in the pool until
+    * all of this group's are done. The first
+    * exception a task throws is thrown again there
+    ***********************************************/
+   class taskGroup
+   {
+   public:
+      explicit taskGroup(threadPool & pool) :
+         pool(pool), numPending(0), pError(nullptr) {}
+      taskGroup(const taskGroup & rhs) = delete;
+      taskGroup & operator = (const taskGroup & rhs) = delete;
+      ~taskGroup();
+
+      void run(std::function <void ()> work);
+      void wait();
+
+   private:
+      threadPool & pool;
+      std::atomic <int> numPending;
+      std::exception_ptr pError;
+      std::mutex mutex;
+
+      friend class threadPool;
+      void execute(Task * pTask);
+   };
+
+/**************************************************** WORK DEQUE DEFINITION ***/
+
+   /**********************************************
+    * WORK DEQUE : DEFAULT CONSTRUCTOR
+    **********************************************/
+   inline workDeque :: workDeque() : top(0), bottom(0), array(newArray(64))
+   {
+   }
+
+   /**********************************************
+    * WORK DEQUE : DESTRUCTOR
+    * Free this array and every one it replaced
+    **********************************************/
+   inline workDeque :: ~workDeque()
+   {
+      Array * pArray = array.load(std::memory_order_relaxed);
+      while (pArray != nullptr)
+      {
+         Array * pOlder = pArray->pOlder;
+         delete [] pArray->tasks;
+         delete pArray;
+         pArray = pOlder;
+      }
+   }
+
+   /**********************************************
+    * WORK DEQUE : PUSH
+    * The task is in place before the bottom moves
+    * past it, so a thief that sees the new bottom
+    * sees the task too
+    **********************************************/
+   inline void workDeque :: push(Task * pTask)
+   {
+      long b = bottom.load(std::memory_order_relaxed);
+      long t = top.load(std::memory_order_acquire);
+      Array * pArray = array.load(std::memory_order_relaxed);
+      if (b - t > pArray->numCapacity - 1)
+         pArray = grow(pArray, b, t);
+
+      pArray->put(b, pTask);
+      bottom.store(b + 1, std::memory_order_release);
+   }
+
+   /**********************************************
+    * WORK DEQUE : TAKE
+    * Claim the bottom task by moving the bottom
+    * up first, then look at the top. Only when one
+    * task is left can a thief want the same one:
+    * then whoever moves the top first gets it
+    **********************************************/
+   inline Task * workDeque :: take()
+   {
+      long b = bottom.load(std::memory_order_relaxed) - 1;
+      Array * pArray = array.load(std::memory_order_relaxed);
+      bottom.store(b, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      long t = top.load(std::memory_order_relaxed);
+
+      // it was empty
+      if (t > b)
+      {
+         bottom.store(b + 1, std::memory_order_relaxed);
+         return nullptr;
+      }
+
+      Task * pTask = pArray->get(b);
+      if (t == b)
+      {
+         if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            pTask = nullptr;
+         bottom.store(b + 1, std::memory_order_relaxed);
+      }
+      return pTask;
+   }
+
+   /**********************************************
+    * WORK DEQUE : STEAL
+    * Read the top task, then claim it by moving
+    * the top on. If that fails another thief, or
+    * the owner, got it first
+    **********************************************/
+   inline Task * workDeque :: steal()
+   {
+      long t = top.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      long b = bottom.load(std::memory_order_acquire);
+      if (t >= b)
+         return nullptr;
+
+      Array * pArray = array.load(std::memory_order_acquire);
+      Task * pTask = pArray->get(t);
+      if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+         return nullptr;
+      return pTask;
+   }
+
+   /**********************************************
+    * WORK DEQUE : NEW ARRAY
+    **********************************************/
+   inline workDeque :: Array * workDeque :: newArray(long numCapacity)
+   {
+      try
+      {
+         Array * pArray = new Array;
+         pArray->numCapacity = numCapacity;
+         pArray->tasks = new std::atomic <Task *> [numCapacity];
+         pArray->pOlder = nullptr;
+         return pArray;
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: Unable to allocate a new buffer for workDeque";
+      }
+   }
+
+   /**********************************************
+    * WORK DEQUE : GROW
+    * Copy the tasks from top to bottom into an
+    * array twice the size
+    **********************************************/
+   inline workDeque :: Array * workDeque :: grow(Array * pArray, long iBottom, long iTop)
+   {
+      Array * pBigger = newArray(pArray->numCapacity * 2);
+      for (long i = iTop; i < iBottom; i++)
+         pBigger->put(i, pArray->get(i));
+      pBigger->pOlder = pArray;
+      array.store(pBigger, std::memory_order_release);
+      return pBigger;
+   }
+
+/*************************************************** THREAD POOL DEFINITION ***/
+
+   /**********************************************
+    * THREAD POOL : NON-DEFAULT CONSTRUCTOR
+    * One worker per core unless told otherwise
+    **********************************************/
+   inline threadPool :: threadPool(int numThreads) :
+      workers(nullptr), numWorkers(0), incoming(POOL_QUEUE_SIZE),
+      numQueued(0), numSleeping(0), isDone(false)
+   {
+      if (numThreads <= 0)
+         numThreads = (int)std::thread::hardware_concurrency();
+      if (numThreads <= 0)
+         numThreads = 1;
+
+      try
+      {
+         workers = new Worker * [numThreads];
+         for (int i = 0; i < numThreads; i++)
+         {
+            workers[i] = new Worker;
+            workers[i]->seed = 2654435761u * (unsigned int)(i + 1);
+         }
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: Unable to allocate the workers for threadPool";
+      }
+
+      // all the workers exist before any of them looks for one to rob
+      numWorkers = numThreads;
+      for (int i = 0; i < numWorkers; i++)
+         workers[i]->thread = std::thread(&threadPool::run, this, workers[i]);
+   }
+
+   /**********************************************
+    * THREAD POOL : DESTRUCTOR
+    * The workers finish what is queued, then stop
+    **********************************************/
+   inline threadPool :: ~threadPool()
+   {
+      {
+         std::lock_guard <std::mutex> lock(mutex);
+         isDone.store(true);
+      }
+      wakeUp.notify_all();
+
+      // a worker still running may look in any other worker's deque
+      for (int i = 0; i < numWorkers; i++)
+         workers[i]->thread.join();
+      for (int i = 0; i < numWorkers; i++)
+         delete workers[i];
+      delete [] workers;
+   }
+
+   /**********************************************
+    * THREAD POOL : SCHEDULE
+    * A worker keeps the tasks it makes, anyone
+    * else queues them. Wake a sleeper if there is
+    * one: the count goes up before the sleepers are
+    * checked, and a sleeper checks the count after
+    * saying it sleeps, so one of them sees the other
+    **********************************************/
+   inline void threadPool :: schedule(Task * pTask)
+   {
+      Worker * pSelf = currentWorker();
+      if (pSelf != nullptr)
+         pSelf->tasks.push(pTask);
+      else
+         incoming.push(pTask);
+
+      numQueued.fetch_add(1);
+      if (numSleeping.load() > 0)
+      {
+         { std::lock_guard <std::mutex> lock(mutex); }
+         wakeUp.notify_one();
+      }
+   }
+
+   /**********************************************
+    * THREAD POOL : RUN ONE
+    * Do one task from anywhere in the pool, if
+    * there is one
+    **********************************************/
+   inline bool threadPool :: runOne()
+   {
+      Task * pTask = findTask(currentWorker());
+      if (pTask == nullptr)
+         return false;
+
+      pTask->pGroup->execute(pTask);
+      return true;
+   }
+
+   /**********************************************
+    * THREAD POOL : FIND TASK
+    * Our own newest task, else one from outside,
+    * else the oldest task of another worker,
+    * starting at a random one so the thieves
+    * spread out
+    **********************************************/
+   inline Task * threadPool :: findTask(Worker * pSelf)
+   {
+      Task * pTask = nullptr;
+      if (pSelf != nullptr)
+         pTask = pSelf->tasks.take();
+      if (pTask == nullptr)
+         incoming.tryPop(pTask);
+
+      if (pTask == nullptr && numWorkers > 0)
+      {
+         unsigned int iStart = 0;
+         if (pSelf != nullptr)
+         {
+            pSelf->seed ^= pSelf->seed << 13;
+            pSelf->seed ^= pSelf->seed >> 17;
+            pSelf->seed ^= pSelf->seed << 5;
+            iStart = pSelf->seed;
+         }
+         for (int i = 0; i < numWorkers && pTask == nullptr; i++)
+         {
+            Worker * pVictim = workers[(iStart + i) % numWorkers];
+            if (pVictim != pSelf)
+               pTask = pVictim->tasks.steal();
+         }
+      }
+
+      if (pTask != nullptr)
+         numQueued.fetch_sub(1);
+      return pTask;
+   }
+
+   /**********************************************
+    * THREAD POOL : RUN
+    * A worker's life: do tasks, look around a
+    * while when there are none, then sleep
+    **********************************************/
+   inline void threadPool :: run(Worker * pSelf)
+   {
+      current() = pSelf;
+      currentPool() = this;
+
+      int numTries = 0;
+      for (;;)
+      {
+         Task * pTask = findTask(pSelf);
+         if (pTask != nullptr)
+         {
+            pTask->pGroup->execute(pTask);
+            numTries = 0;
+         }
+         else if (isDone.load() && numQueued.load() == 0)
+            return;
+         else if (++numTries < POOL_SPIN_LIMIT)
+            std::this_thread::yield();
+         else
+         {
+            sleep();
+            numTries = 0;
+         }
+      }
+   }
+
+   /**********************************************
+    * THREAD POOL : SLEEP
+    * Until a task is queued or the pool is done
+    **********************************************/
+   inline void threadPool :: sleep()
+   {
+      std::unique_lock <std::mutex> lock(mutex);
+      numSleeping.fetch_add(1);
+      while (numQueued.load() == 0 && !isDone.load())
+         wakeUp.wait(lock);
+      numSleeping.fetch_sub(1);
+   }
+
+   /**********************************************
+    * THREAD POOL : CURRENT WORKER
+    **********************************************/
+   inline threadPool :: Worker * threadPool :: currentWorker() const
+   {
+      return (currentPool() == this ? current() : nullptr);
+   }
+
+   inline threadPool :: Worker *& threadPool :: current()
+   {
+      static thread_local Worker * pWorker = nullptr;
+      return pWorker;
+   }
+
+   inline const threadPool *& threadPool :: currentPool()
+   {
+      static thread_local const threadPool * pPool = nullptr;
+      return pPool;
+   }
+
+/**************************************************** TASK GROUP DEFINITION ***/
+
+   /**********************************************
+    * TASK GROUP : DESTRUCTOR
+    * Tasks point at the group: it cannot go away
+    * while any are left
+    **********************************************/
+   inline taskGroup :: ~taskGroup()
+   {
+      while (numPending.load(std::memory_order_acquire) != 0)
+         if (!pool.runOne())
+            std::this_thread::yield();
+   }
+
+   /**********************************************
+    * TASK GROUP : RUN
+    **********************************************/
+   inline void taskGroup :: run(std::function <void ()> work)
+   {
+      Task * pTask;
+      try
+      {
+         pTask = new Task;
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: Unable to allocate a new task for taskGroup";
+      }
+      pTask->work = std::move(work);
+      pTask->pGroup = this;
+
+      numPending.fetch_add(1, std::memory_order_relaxed);
+      pool.schedule(pTask);
+   }
+
+   /**********************************************
+    * TASK GROUP : WAIT
+    * Rather than block, do tasks until ours are
+    * done: the task we wait for may be behind them
+    **********************************************/
+   inline void taskGroup :: wait()
+   {
+      while (numPending.load(std::memory_order_acquire) != 0)
+         if (!pool.runOne())
+            std::this_thread::yield();
+
+      if (pError != nullptr)
+      {
+         std::exception_ptr pThrow = pError;
+         pError = nullptr;
+         std::rethrow_exception(pThrow);
+      }
+   }
+
+   /**********************************************
+    * TASK GROUP : EXECUTE
+    * Run one of our tasks and count it done. The
+    * release lets the waiter see what it did
+    **********************************************/
+   inline void taskGroup :: execute(Task * pTask)
+   {
+      try
+      {
+         pTask->work();
+      }
+      catch (...)
+      {
+         std::lock_guard <std::mutex> lock(mutex);
+         if (pError == nullptr)
+            pError = std::current_exception();
+      }
+      delete pTask;
+      numPending.fetch_sub(1, std::memory_order_release);
+   }
+
+/********************************************* PARALLEL HELPERS DEFINITION ***/
+
+   /**********************************************
+    * PARALLEL FOR
+    * Call f(i) for every i in [iBegin, iEnd). The
+    * range is halved until a piece is no bigger
+    * than numGrain; the upper half of every split
+    * is left for a thief
+    **********************************************/
+   template <class Function>
+   void parallelFor(threadPool & pool, int iBegin, int iEnd, int numGrain,
+                    const Function & f)
+   {
+      if (numGrain < 1)
+         numGrain = 1;
+
+      if (iEnd - iBegin <= numGrain)
+      {
+         for (int i = iBegin; i < iEnd; i++)
+            f(i);
+         return;
+      }
+
+      int iMiddle = iBegin + (iEnd - iBegin) / 2;
+      taskGroup group(pool);
+      group.run([&pool, iMiddle, iEnd, numGrain, &f]()
+      {
+         parallelFor(pool, iMiddle, iEnd, numGrain, f);
+      });
+      parallelFor(pool, iBegin, iMiddle, numGrain, f);
+      group.wait();
+   }
+
+   /**********************************************
+    * PARALLEL INVOKE
+    * Fork g, do f here, then join
+    **********************************************/
+   template <class FunctionF, class FunctionG>
+   void parallelInvoke(threadPool & pool, const FunctionF & f, const FunctionG & g)
+   {
+      taskGroup group(pool);
+      group.run([&g]() { g(); });
+      f();
+      group.wait();
+   }
+}; //end namespace custom
+
+#endif // THREAD_POOL_H
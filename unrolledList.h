@@ -0,0 +1,624 @@
+/***********************************************************************
+ * Header:
+ *    This is the header file for an "unrolled list" abstract data type
+ * Summary:
+ *    This class contains a linked list whose nodes each hold a small
+ *    array of elements instead of just one. It has the interface of
+ *    custom::list, but walking it reads a few cache lines of elements
+ *    side by side before following a pointer, so a scan runs close to
+ *    the speed of a vector. Inserting in the middle still only shifts
+ *    the elements of one block.
+ *    Every block but the last is kept at least half full, so the list
+ *    never takes much more room than a vector would.
+ *
+ *    This will contain the class definition of:
+ *       unrolledList             : a list of blocks of elements
+ *       unrolledList :: iterator : a block and a place in it
+ * Author
+ *    Daniel Perez, Jamie Hurd, Benjamin Dyas
+ ************************************************************************/
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <new>          // for BAD_ALLOC
+
+#define UNROLLED_BLOCK_BYTES 256   // four cache lines per block
+
+namespace custom
+{
+   /************************************************
+    * CLASS UNROLLED LIST
+    * A list of blocks, each holding up to
+    * BLOCK_MAX elements in order
+    ***********************************************/
+   template <class T>
+   class unrolledList
+   {
+      // as many as fit in the block, and never fewer than four
+      static const int BLOCK_MAX = (UNROLLED_BLOCK_BYTES / sizeof(T) > 4 ?
+                                    (int)(UNROLLED_BLOCK_BYTES / sizeof(T)) : 4);
+
+      struct Block
+      {
+         Block * pNext;
+         Block * pPrev;
+         int numItems;
+         T items[BLOCK_MAX];
+      };
+
+   public:
+      //constructors and destructor
+      unrolledList() : pHead{ nullptr }, pTail{ nullptr }, numElements{ 0 } {}
+      unrolledList(const unrolledList & rhs);
+      ~unrolledList() { clear(); }
+
+      //overloaded operators
+      unrolledList & operator = (const unrolledList & rhs);
+
+      // the various iterator interfaces. The end is one past the last
+      //    element of the last block
+      class iterator;
+      iterator begin()  { return iterator(pHead, 0); }
+      iterator end()    { return iterator(pTail, pTail ? pTail->numItems : 0); }
+
+      class const_iterator;
+      const_iterator cbegin() const { return const_iterator(pHead, 0); }
+      const_iterator cend()   const { return const_iterator(pTail, pTail ? pTail->numItems : 0); }
+
+      // standard container interfaces
+      int       size() const { return numElements; }
+      bool      empty()const { return (numElements == 0); }
+      void      clear();
+      void      push_back(const T& element);
+      void      push_front(const T& element);
+      void      pop_back();
+      void      pop_front();
+      T &       back();
+      const T   back() const;
+      T &       front();
+      const T   front() const;
+
+      iterator  find(const T & element);
+      iterator  erase(iterator it);
+      iterator  insert(iterator it, const T& t);
+
+   private:
+      //members
+      Block * pHead;
+      Block * pTail;
+      int numElements;
+
+      //methods
+      Block *   newBlock(Block * pAfter);
+      void      deleteBlock(Block * pBlock);
+      iterator  normalize(Block * pBlock, int i);
+   };
+
+/***************************************************** ITERATOR DEFINITION ***/
+
+   /**************************************************
+    * UNROLLED LIST ITERATOR
+    * A block and the index of an element in it. Only
+    * the end sits one past the last element of a block
+    *************************************************/
+   template <class T>
+   class unrolledList <T> :: iterator
+   {
+   public:
+      //friend
+      friend class unrolledList<T>;
+
+      // constructors, destructors, and assignment operator
+      iterator() : p(nullptr), i(0) {}
+      iterator(Block * p, int i) : p(p), i(i) {}
+      iterator(const iterator & rhs) { *this = rhs; }
+
+      iterator & operator = (const iterator & rhs)
+      {
+         this->p = rhs.p;
+         this->i = rhs.i;
+         return *this;
+      }
+
+      // equals, not equals operator
+      bool operator != (const iterator & rhs) const { return rhs.p != this->p || rhs.i != this->i; }
+      bool operator == (const iterator & rhs) const { return rhs.p == this->p && rhs.i == this->i; }
+
+      // dereference operator
+            T & operator * ()       { return p->items[i]; }
+      const T & operator * () const { return p->items[i]; }
+
+      // prefix increment: the next block only when this one is done
+      iterator & operator ++ ()
+      {
+         if (++i == p->numItems && p->pNext != nullptr)
+         {
+            p = p->pNext;
+            i = 0;
+         }
+         return *this;
+      }
+
+      // postfix increment
+      iterator operator ++ (int postfix)
+      {
+         iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+      // prefix decrement
+      iterator & operator -- ()
+      {
+         if (i == 0 && p->pPrev != nullptr)
+         {
+            p = p->pPrev;
+            i = p->numItems;
+         }
+         --i;
+         return *this;
+      }
+
+      // postfix decrement
+      iterator operator -- (int postfix)
+      {
+         iterator tmp(*this);
+         --(*this);
+         return tmp;
+      }
+
+   private:
+      Block * p;
+      int i;
+   };
+
+   /**************************************************
+    * UNROLLED LIST CONST_ITERATOR
+    * The same, read only
+    *************************************************/
+   template <class T>
+   class unrolledList <T> :: const_iterator
+   {
+   public:
+      // constructors, destructors, and assignment operator
+      const_iterator() : p(nullptr), i(0) {}
+      const_iterator(const Block * p, int i) : p(p), i(i) {}
+      const_iterator(const const_iterator & rhs) { *this = rhs; }
+      const_iterator(const iterator & rhs) : p(rhs.p), i(rhs.i) {}
+
+      const_iterator & operator = (const const_iterator & rhs)
+      {
+         this->p = rhs.p;
+         this->i = rhs.i;
+         return *this;
+      }
+
+      // equals, not equals operator
+      bool operator != (const const_iterator & rhs) const { return rhs.p != this->p || rhs.i != this->i; }
+      bool operator == (const const_iterator & rhs) const { return rhs.p == this->p && rhs.i == this->i; }
+
+      // dereference operator
+      const T & operator * () const { return p->items[i]; }
+
+      // prefix increment
+      const_iterator & operator ++ ()
+      {
+         if (++i == p->numItems && p->pNext != nullptr)
+         {
+            p = p->pNext;
+            i = 0;
+         }
+         return *this;
+      }
+
+      // postfix increment
+      const_iterator operator ++ (int postfix)
+      {
+         const_iterator tmp(*this);
+         ++(*this);
+         return tmp;
+      }
+
+      // prefix decrement
+      const_iterator & operator -- ()
+      {
+         if (i == 0 && p->pPrev != nullptr)
+         {
+            p = p->pPrev;
+            i = p->numItems;
+         }
+         --i;
+         return *this;
+      }
+
+      // postfix decrement
+      const_iterator operator -- (int postfix)
+      {
+         const_iterator tmp(*this);
+         --(*this);
+         return tmp;
+      }
+
+   private:
+      const Block * p;
+      int i;
+   };
+
+/************************************************** CONSTRUCTOR DEFINITION ***/
+
+   /********************************************
+    * FUNCTION:  UNROLLED LIST :: COPY CONSTRUCTOR
+    ********************************************/
+   template <class T>
+   unrolledList<T> :: unrolledList(const unrolledList<T> & rhs) :
+      pHead{ nullptr }, pTail{ nullptr }, numElements{ 0 }
+   {
+      *this = rhs;
+   }
+
+/***************************************** OVERLOADED OPERATORS DEFINITION ***/
+
+   /********************************************
+    * FUNCTION:  Assignment Operator Overload
+    * DESCRIPTION: the copy has full blocks, even
+    *              where rhs only has half full ones
+    ********************************************/
+   template <class T>
+   unrolledList<T> & unrolledList<T> :: operator = (const unrolledList<T> & rhs)
+   {
+      if (this == &rhs)
+      {
+         return *this;
+      }
+
+      clear();
+      for (const Block * p = rhs.pHead; p; p = p->pNext)
+      {
+         for (int i = 0; i < p->numItems; i++)
+         {
+            push_back(p->items[i]);
+         }
+      }
+      return *this;
+   }
+
+/************************************** LIST SPECIFIC INTERFACES DEFINITION ***/
+
+   /********************************************
+    * FUNCTION:     CLEAR
+    * DESCRIPTION:  clears the list
+    ********************************************/
+   template <class T>
+   void unrolledList<T>::clear()
+   {
+      while (pHead != nullptr)
+      {
+         Block * pDelete = pHead;
+         pHead = pHead->pNext;
+         delete pDelete;
+      }
+
+      pTail = nullptr;
+      numElements = 0;
+   }
+
+   /********************************************
+    * FUNCTION:  PUSH_BACK
+    * DESCRIPTION: adds an element to the back,
+    *              starting a block if the last
+    *              one is full
+    ********************************************/
+   template <class T>
+   void unrolledList<T>::push_back(const T& element)
+   {
+      if (pTail == nullptr || pTail->numItems == BLOCK_MAX)
+      {
+         newBlock(pTail);
+      }
+
+      pTail->items[pTail->numItems++] = element;
+      numElements++;
+   }
+
+   /********************************************
+    * FUNCTION:  PUSH_FRONT
+    * DESCRIPTION: adds an element to the front
+    ********************************************/
+   template <class T>
+   void unrolledList<T>::push_front(const T& element)
+   {
+      insert(begin(), element);
+   }
+
+   /********************************************
+    * FUNCTION:  POP_BACK
+    * DESCRIPTION: removes the back element
+    ********************************************/
+   template <class T>
+   void unrolledList<T>::pop_back()
+   {
+      if (!empty())
+      {
+         erase(iterator(pTail, pTail->numItems - 1));
+      }
+   }
+
+   /********************************************
+    * FUNCTION:  POP_FRONT
+    * DESCRIPTION: removes the front element
+    ********************************************/
+   template <class T>
+   void unrolledList<T>::pop_front()
+   {
+      if (!empty())
+      {
+         erase(begin());
+      }
+   }
+
+   /********************************************
+    * FUNCTION:  BACK
+    * RETURNS:   the back of the list
+    ********************************************/
+   template <class T>
+   T& unrolledList<T>::back()
+   {
+      if (empty())
+      {
+         throw "ERROR: unable to access data from an empty unrolledList";
+      }
+      return pTail->items[pTail->numItems - 1];
+   }
+
+   template <class T>
+   const T unrolledList<T>::back() const
+   {
+      if (empty())
+      {
+         throw "ERROR: unable to access data from an empty unrolledList";
+      }
+      return pTail->items[pTail->numItems - 1];
+   }
+
+   /********************************************
+    * FUNCTION:  FRONT
+    * RETURNS:   the front of the list
+    ********************************************/
+   template <class T>
+   T& unrolledList<T>::front()
+   {
+      if (empty())
+      {
+         throw "ERROR: unable to access data from an empty unrolledList";
+      }
+      return pHead->items[0];
+   }
+
+   template <class T>
+   const T unrolledList<T>::front() const
+   {
+      if (empty())
+      {
+         throw "ERROR: unable to access data from an empty unrolledList";
+      }
+      return pHead->items[0];
+   }
+
+   /********************************************
+    * FUNCTION:     FIND
+    * DESCRIPTION:  searches for a value, a block
+    *               at a time
+    * PARAMETER:    receives an element to find
+    ********************************************/
+   template <class T>
+   typename unrolledList<T>::iterator unrolledList<T>::find(const T & element)
+   {
+      for (Block * p = pHead; p; p = p->pNext)
+      {
+         for (int i = 0; i < p->numItems; i++)
+         {
+            if (p->items[i] == element)
+            {
+               return iterator(p, i);
+            }
+         }
+      }
+      return end();
+   }
+
+   /********************************************
+    * FUNCTION:     ERASE
+    * DESCRIPTION:  removes the requested item by
+    *               closing the gap in its block. A
+    *               block less than half full takes
+    *               in the next one if they fit
+    *               together, or else borrows its
+    *               first element; an empty one
+    *               goes away
+    * RETURNS:      the element after the one removed
+    * PARAMETER:    an iterator
+    ********************************************/
+   template <class T>
+   typename unrolledList<T>::iterator unrolledList<T>::erase(iterator it)
+   {
+      Block * p = it.p;
+      if (p == nullptr || it.i >= p->numItems)
+      {
+         return end();
+      }
+
+      for (int i = it.i + 1; i < p->numItems; i++)
+      {
+         p->items[i - 1] = p->items[i];
+      }
+      p->numItems--;
+      numElements--;
+
+      if (p->numItems == 0)
+      {
+         Block * pNext = p->pNext;
+         deleteBlock(p);
+         return (pNext ? iterator(pNext, 0) : end());
+      }
+
+      Block * pNext = p->pNext;
+      if (pNext != nullptr && p->numItems < BLOCK_MAX / 2)
+      {
+         if (p->numItems + pNext->numItems <= BLOCK_MAX)
+         {
+            for (int i = 0; i < pNext->numItems; i++)
+            {
+               p->items[p->numItems + i] = pNext->items[i];
+            }
+            p->numItems += pNext->numItems;
+            deleteBlock(pNext);
+         }
+         else
+         {
+            //the next one is more than half full: it can spare one
+            p->items[p->numItems++] = pNext->items[0];
+            for (int i = 1; i < pNext->numItems; i++)
+            {
+               pNext->items[i - 1] = pNext->items[i];
+            }
+            pNext->numItems--;
+         }
+      }
+
+      return normalize(p, it.i);
+   }
+
+   /********************************************
+    * FUNCTION:     INSERT
+    * DESCRIPTION:  inserts a value in front of it.
+    *               A full block is split in two
+    *               halves first
+    * RETURNS:      the element inserted
+    * PARAMETER:    an iterator and data
+    ********************************************/
+   template <class T>
+   typename unrolledList<T>::iterator unrolledList<T>::insert(iterator it, const T& t)
+   {
+      //on the end: no need to split the last block
+      if (it.p == nullptr || (it.p == pTail && it.i == pTail->numItems))
+      {
+         push_back(t);
+         return iterator(pTail, pTail->numItems - 1);
+      }
+
+      Block * p = it.p;
+      int iInsert = it.i;
+      if (p->numItems == BLOCK_MAX)
+      {
+         Block * pSplit = newBlock(p);
+         int numKeep = BLOCK_MAX / 2;
+         for (int i = numKeep; i < BLOCK_MAX; i++)
+         {
+            pSplit->items[i - numKeep] = p->items[i];
+         }
+         pSplit->numItems = BLOCK_MAX - numKeep;
+         p->numItems = numKeep;
+
+         if (iInsert > numKeep)
+         {
+            p = pSplit;
+            iInsert -= numKeep;
+         }
+      }
+
+      for (int i = p->numItems; i > iInsert; i--)
+      {
+         p->items[i] = p->items[i - 1];
+      }
+      p->items[iInsert] = t;
+      p->numItems++;
+      numElements++;
+      return iterator(p, iInsert);
+   }
+
+/******************************************** PRIVATE FUNCTIONS DEFINITION ***/
+
+   /********************************************
+    * FUNCTION:     NEW BLOCK
+    * DESCRIPTION:  an empty block linked in after
+    *               pAfter, or at the front if null
+    ********************************************/
+   template <class T>
+   typename unrolledList<T>::Block * unrolledList<T>::newBlock(Block * pAfter)
+   {
+      Block * pNew;
+      try
+      {
+         pNew = new Block;
+      }
+      catch (std::bad_alloc &)
+      {
+         throw "ERROR: unable to allocate a new block for an unrolledList";
+      }
+
+      pNew->numItems = 0;
+      pNew->pPrev = pAfter;
+      pNew->pNext = (pAfter ? pAfter->pNext : pHead);
+      if (pNew->pNext)
+      {
+         pNew->pNext->pPrev = pNew;
+      }
+      else
+      {
+         pTail = pNew;
+      }
+      if (pAfter)
+      {
+         pAfter->pNext = pNew;
+      }
+      else
+      {
+         pHead = pNew;
+      }
+      return pNew;
+   }
+
+   /********************************************
+    * FUNCTION:     DELETE BLOCK
+    * DESCRIPTION:  unlinks and frees a block
+    ********************************************/
+   template <class T>
+   void unrolledList<T>::deleteBlock(Block * pBlock)
+   {
+      if (pBlock->pPrev)
+      {
+         pBlock->pPrev->pNext = pBlock->pNext;
+      }
+      else
+      {
+         pHead = pBlock->pNext;
+      }
+
+      if (pBlock->pNext)
+      {
+         pBlock->pNext->pPrev = pBlock->pPrev;
+      }
+      else
+      {
+         pTail = pBlock->pPrev;
+      }
+      delete pBlock;
+   }
+
+   /********************************************
+    * FUNCTION:     NORMALIZE
+    * DESCRIPTION:  one past the last element of a
+    *               block is the start of the next
+    ********************************************/
+   template <class T>
+   typename unrolledList<T>::iterator unrolledList<T>::normalize(Block * pBlock, int i)
+   {
+      if (i == pBlock->numItems && pBlock->pNext != nullptr)
+      {
+         return iterator(pBlock->pNext, 0);
+      }
+      return iterator(pBlock, i);
+   }
+}; //end namespace custom
+
+#endif // UNROLLED_LIST_H
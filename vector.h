@@ -17,6 +17,11 @@
 #define VECTOR_H
 
 #include <cassert>  // because I am paranoid
+#include <cstring>  // for MEMCPY
+#include <new>      // for placement NEW
+#include <type_traits>
+#include <utility>  // for MOVE and FORWARD
+#include "smallBuffer.h"
 
 // a little helper macro to write debug code
 #ifdef NDEBUG
@@ -31,21 +36,28 @@ namespace custom
     /************************************************
     * VECTOR
     * A class that holds stuff and that changes
-    * sizes dynamically
+    * sizes dynamically. The buffer is raw memory:
+    * only the first size() slots hold constructed
+    * items, so growing never builds items that are
+    * thrown away. The first N items are kept inside
+    * the vector itself, so a vector that stays that
+    * small never allocates
     ***********************************************/
-    template <class T>
-    class vector
+    template <class T, int N = 0>
+    class vector : private RawBuffer <T, N>
     {
     public:
         // constructors and destructors
-        vector() :numCapacity{ 0 }, numElements{ 0 }, data{ nullptr } {}
+        vector() :numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() } {}
         vector(int numElements);
         vector(int numElements, const T& t);
         vector(const vector & rhs);
-        ~vector() { if(data!= nullptr)delete [] data; }
+        vector(vector && rhs);
+        ~vector() { release(); }
 
         //overloaded operators
         vector & operator = (const vector & rhs);
+        vector & operator = (vector && rhs);
    
         // standard container interfaces
         // array treats size and max_size the same
@@ -53,6 +65,7 @@ namespace custom
         int   capacity()  const { return numCapacity; }
         bool  empty()     const { return (numElements == 0); }
         void  clear();
+        void  reserve(int newCapacity);
    
         // container-specific interfaces
         // what would happen if I passed -1 or something greater than num?
@@ -66,6 +79,9 @@ namespace custom
         }
 
         void push_back(const T & element);
+        void push_back(T && element);
+        template <class ... Args>
+        T & emplace_back(Args && ... args);
    
         // the various iterator interfaces
         class iterator;
@@ -86,6 +102,16 @@ namespace custom
         int numCapacity;
 
         void resize(int newCapacity);
+        T * allocate(int num);
+        void deallocate(T * p) { if (p != nullptr && p != this->inlineData()) ::operator delete(p); }
+        void destroy(int iBegin);
+        void release() { destroy(0); deallocate(data); }
+        static void copyConstruct(T * pDest, const T * pSource, int num);
+        static void moveConstruct(T * pDest, T * pSource, int num);
+        void take(vector & rhs);
+
+        //are the items in the room inside the vector?
+        bool isInline() const { return N > 0 && data == this->inlineData(); }
     };
 
     /**************************************************
@@ -93,8 +119,8 @@ namespace custom
     * An iterator through the internal array of 
     * the vector
     *************************************************/
-    template <class T>
-    class vector <T> ::iterator
+    template <class T, int N>
+    class vector <T, N> ::iterator
     {
     public:
         // constructors, destructors, and assignment operator
@@ -154,8 +180,8 @@ namespace custom
     * Note that you have to use "typename" before
     * the return value type
     ********************************************/
-    template <class T>
-    typename vector <T> ::iterator vector <T> ::end()
+    template <class T, int N>
+    typename vector <T, N> ::iterator vector <T, N> ::end()
     {
         return iterator(data + numElements);
     }
@@ -165,36 +191,28 @@ namespace custom
     *        : ONE PARAMETER
     * Preallocate the array to "capacity"
     **********************************************/
-    template <class T>
-    vector<T>::vector(int numElements)
+    template <class T, int N>
+    vector<T, N>::vector(int numElements) :
+        numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() }
     { 
         //in case a zero or negative number is passed
         if (numElements < 1)
         {
-            //this->numCapacity = 0;
-            this->numElements = 0;
-            this->data = nullptr;
-            
             /*if (numElements < 0)
                 cout << "Size can't be negative: zero space allocated" << endl;*/
             return;
         }
 
-        try
+        //the room inside the vector is used if they fit
+        if (numElements > N)
         {
-            data = new T[numElements];
+            data = allocate(numElements);
+            this->numCapacity = numElements;
         }
-        catch (std::bad_alloc)
-        {
-            //to verify later on in case allocation fails
-            data = nullptr;
 
-            throw "ERROR: Unable to allocate buffer";
-        }
-
-        //initially capacity and size are the same
-        this->numCapacity = numElements;
-        this->numElements = numElements;
+        //every item starts out as a default item
+        for (; this->numElements < numElements; this->numElements++)
+            new (data + this->numElements) T();
     }
 
     /**********************************************
@@ -203,95 +221,71 @@ namespace custom
     * Preallocate the array to "capacity"
     * Assign second argument to all members of array
     **********************************************/
-    template <class T>
-    vector<T>::vector(int numElements,const T &t)
+    template <class T, int N>
+    vector<T, N>::vector(int numElements,const T &t) :
+        numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() }
     {
         //in case a zero or negative number is passed
         if (numElements < 1)
         {
-            //this->numCapacity = 0;
-            this->numElements = 0;
-            this->data = nullptr;
-
             /*if (numElements < 0)
                 cout << "Size can't be negative: zero space allocated" << endl;*/
             return;
         }
 
-        // attempt to allocate
-        try
+        //the room inside the vector is used if they fit
+        if (numElements > N)
         {
-            data = new T[numElements];
+            data = allocate(numElements);
+            this->numCapacity = numElements;
         }
-        catch (std::bad_alloc)
-        {
-            //to verify later on in case allocation fails
-            data = nullptr;
-
-            throw "ERROR: Unable to allocate buffer";
-        }
-
-        //initially capacity and size are the same
-        this->numCapacity = numElements;
-        this->numElements = numElements;
 
-        //Loop through the array assigning value t
+        //Loop through the array building copies of t
         // t is whatever object or variable is passed
-        for (int i = 0; i < numElements; ++i)
-        {
-            data[i] = t;
-        }
+        for (; this->numElements < numElements; this->numElements++)
+            new (data + this->numElements) T(t);
     }
 
     /*******************************************
      * VECTOR :: COPY CONSTRUCTOR
      *******************************************/
-    template <class T>
-    vector <T> ::vector(const vector <T>& rhs)
+    template <class T, int N>
+    vector <T, N> ::vector(const vector <T, N>& rhs) :
+        numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() }
     {
         //assert(rhs.numElements >= 0);
 
-        // do nothing if there is nothing to do
-        if (rhs.numElements == 0)
-        {
-            //numElements = 0;
-            //numCapacity = 0;
-            data = nullptr;
-            return;
-        }
-
-        // attempt to allocate
-        try
+        // only the items are copied, so only they have to fit
+        if (rhs.numElements > N)
         {
-            data = new T[rhs.numElements];
-        }
-        catch (std::bad_alloc)
-        {
-            //to verify later on in case allocation fails
-            data = nullptr;
-
-            throw "ERROR: Unable to allocate buffer";
+            data = allocate(rhs.numElements);
+            this->numCapacity = rhs.numElements;
         }
 
-        // copy over the capacity
+        copyConstruct(data, rhs.data, rhs.numElements);
         this->numElements = rhs.numElements;
-        this->numCapacity = rhs.numCapacity;
+    }
 
-        // copy the items over one at a time using the assignment operator
-        for (int i = 0; i < numElements; i++)
-            data[i] = rhs.data[i];
+    /*******************************************
+     * VECTOR :: MOVE CONSTRUCTOR
+     * Take the buffer of a vector about to go
+     * away instead of copying it
+     *******************************************/
+    template <class T, int N>
+    vector <T, N> ::vector(vector <T, N> && rhs) :
+        numCapacity{ N }, numElements{ 0 }, data{ this->inlineData() }
+    {
+        take(rhs);
     }
 
     /********************************************
      * VECTOR : RESIZE
-     * Dynamically resizes the vector
+     * Dynamically resizes the vector. The items
+     * are moved to the new buffer, not copied
      *******************************************/
-    template <class T>
-    void vector<T> ::resize(int newCapacity)
+    template <class T, int N>
+    void vector<T, N> ::resize(int newCapacity)
     {
-        // create a temporary pointer for array swap
-        T* tempData = nullptr;
-
         // The special case of newCapacity being 0 is handled
         // This happens when vector is default constructed with a 
         //    size and capacity of zero. The first time it doesn't double:
@@ -301,47 +295,157 @@ namespace custom
             newCapacity = 1;
         }
 
-        //attempt to allocate
+        // create a temporary pointer for array swap
+        T* tempData = allocate(newCapacity);
+        moveConstruct(tempData, data, numElements);
+
+        //the moved-from items still have to be destroyed
+        int num = numElements;
+        release();
+        numElements = num;
+
+        //By copying the pointer, the nameless array in the heap is transferred 
+        data = tempData;
+        this->numCapacity = newCapacity;
+    }
+
+    /********************************************
+     * VECTOR : ALLOCATE
+     * Room for num items: the room inside the
+     * vector if they fit there, otherwise raw
+     * memory from the heap. Nothing is built yet
+     *******************************************/
+    template <class T, int N>
+    T * vector<T, N> ::allocate(int num)
+    {
+        if (num <= N)
+            return this->inlineData();
+
         try
         {
-            tempData = new T[newCapacity];
+            return static_cast <T *> (::operator new(sizeof(T) * num));
         }
-        catch (std::bad_alloc)
+        catch (std::bad_alloc &)
         {
-            throw "ERROR: Unable to allocate buffer while resizing vector";
+            throw "ERROR: Unable to allocate buffer";
         }
-        for (int i = 0; i < numElements; i++)
-            tempData[i] = data[i];
+    }
 
-        delete[] data;
-        
-        //By copying the pointer, the nameless array in the heap is transferred 
-        data = tempData;
+    /********************************************
+     * VECTOR : DESTROY
+     * Destroy the items from iBegin to the end.
+     * Items with nothing to clean up are skipped
+     *******************************************/
+    template <class T, int N>
+    void vector<T, N> ::destroy(int iBegin)
+    {
+        if constexpr (!std::is_trivially_destructible <T>::value)
+            for (int i = iBegin; i < numElements; i++)
+                data[i].~T();
+        if (iBegin < numElements)
+            numElements = iBegin;
+    }
 
+    /********************************************
+     * VECTOR : COPY CONSTRUCT
+     * Build copies of num items in raw memory.
+     * Plain old data is copied in one go
+     *******************************************/
+    template <class T, int N>
+    void vector<T, N> ::copyConstruct(T * pDest, const T * pSource, int num)
+    {
+        if constexpr (std::is_trivially_copyable <T>::value)
+        {
+            if (num > 0)
+                std::memcpy((void *)pDest, (const void *)pSource, sizeof(T) * num);
+        }
+        else
+            for (int i = 0; i < num; i++)
+                new (pDest + i) T(pSource[i]);
+    }
 
-        this->numCapacity = newCapacity;
+    /********************************************
+     * VECTOR : MOVE CONSTRUCT
+     * Move num items into raw memory. The old
+     * items are left to be destroyed
+     *******************************************/
+    template <class T, int N>
+    void vector<T, N> ::moveConstruct(T * pDest, T * pSource, int num)
+    {
+        if constexpr (std::is_trivially_copyable <T>::value)
+        {
+            if (num > 0)
+                std::memcpy((void *)pDest, (const void *)pSource, sizeof(T) * num);
+        }
+        else
+            for (int i = 0; i < num; i++)
+                new (pDest + i) T(std::move(pSource[i]));
+    }
+
+    /********************************************
+     * VECTOR : TAKE
+     * Take the items of another vector, which is
+     * left empty. Items inside the other vector
+     * can't be taken: they are moved one by one
+     *******************************************/
+    template <class T, int N>
+    void vector<T, N> ::take(vector <T, N> & rhs)
+    {
+        release();
+
+        if (rhs.isInline())
+        {
+            data = this->inlineData();
+            numCapacity = N;
+            moveConstruct(data, rhs.data, rhs.numElements);
+            numElements = rhs.numElements;
+            rhs.destroy(0);
+        }
+        else
+        {
+            data = rhs.data;
+            numElements = rhs.numElements;
+            numCapacity = rhs.numCapacity;
+        }
 
+        rhs.data = rhs.inlineData();
+        rhs.numElements = 0;
+        rhs.numCapacity = N;
     }
 
     /********************************************
      * VECTOR : CLEAR
      * sets vector size to zero: doesn't deallocate 
      *******************************************/
-    template <class T>
-    void vector<T>::clear()
+    template <class T, int N>
+    void vector<T, N>::clear()
     {
-        numElements = 0;
+        destroy(0);
+    }
 
+    /********************************************
+     * VECTOR : RESERVE
+     * Make room for newCapacity items, so that
+     * many can be added without growing again
+     *******************************************/
+    template <class T, int N>
+    void vector<T, N>::reserve(int newCapacity)
+    {
+        if (newCapacity > numCapacity)
+            resize(newCapacity);
     }
 
     /********************************************
      * VECTOR : ASSIGN OPERATOR OVERLOAD
      *******************************************/
-    template <class T>
-    vector <T>& vector <T> :: operator = (const vector <T>& rhs)
+    template <class T, int N>
+    vector <T, N>& vector <T, N> :: operator = (const vector <T, N>& rhs)
     {
-        // out of extreme caution, technically not needed
-        numElements = 0;
+        if (this == &rhs)
+            return *this;
+
+        // the old items go before the new ones are copied in
+        clear();
 
         // if incoming object is bigger, resize allocated space
         if ( rhs.size() > this->capacity() )
@@ -349,15 +453,21 @@ namespace custom
             this->resize(rhs.size());
         }
 
-        // update array size to assigned size
+        //Copy data from source to local array
+        copyConstruct(data, rhs.data, rhs.numElements);
         numElements = rhs.size();
 
-        //Copy data from source to local array
-        for (int i = 0; i < numElements; i++)
-        {
-            data[i] = rhs.data[i];
-        }
+        return *this;
+    }
 
+    /********************************************
+     * VECTOR : MOVE ASSIGN OPERATOR OVERLOAD
+     *******************************************/
+    template <class T, int N>
+    vector <T, N>& vector <T, N> :: operator = (vector <T, N>&& rhs)
+    {
+        if (this != &rhs)
+            take(rhs);
         return *this;
     }
 
@@ -366,18 +476,45 @@ namespace custom
      * adds new element to array; calls for
      * resizing if the array is at capacity
      *******************************************/
-    template <class T>
-    void vector<T> :: push_back(const T& element)
+    template <class T, int N>
+    void vector<T, N> :: push_back(const T& element)
+    {
+        emplace_back(element);
+    }
+
+    /********************************************
+     * VECTOR : PUSH_BACK
+     * adds an element that is going away, by
+     * moving it in
+     *******************************************/
+    template <class T, int N>
+    void vector<T, N> :: push_back(T&& element)
+    {
+        emplace_back(std::move(element));
+    }
+
+    /********************************************
+     * VECTOR : EMPLACE_BACK
+     * builds a new element at the end of the
+     * array from the arguments of its constructor
+     *******************************************/
+    template <class T, int N>
+    template <class ... Args>
+    T & vector<T, N> :: emplace_back(Args && ... args)
     {
-        // if Array is at capacity, resize (double)
+        // if Array is at capacity, resize (double). The arguments may
+        //    be items of this vector: build the new one before they move
         if (this->size() == this->capacity())
         {
+            T element(std::forward <Args> (args)...);
             resize( (capacity() * 2) );
+            new (data + numElements) T(std::move(element));
         }
+        else
+            new (data + numElements) T(std::forward <Args> (args)...);
 
         // add new element to the end of the array
-        data[numElements++] = element;
-        
+        return data[numElements++];
     }
     /***********CONSTANT ITERATOR DECLARATION AND EXPERIMENT***************/
 
@@ -386,8 +523,8 @@ namespace custom
     * A constant iterator through the internal array of
     * the vector
     *************************************************/
-    template <class T>
-    class vector <T> ::const_iterator
+    template <class T, int N>
+    class vector <T, N> ::const_iterator
     {
     public:
         // constructors, destructors, and assignment operator
@@ -447,8 +584,8 @@ namespace custom
     * Note that you have to use "typename" before
     * the return value type
     ********************************************/
-    template <class T>
-    typename vector <T> ::const_iterator vector <T> ::cend() const //had to make a promise to compiler
+    template <class T, int N>
+    typename vector <T, N> ::const_iterator vector <T, N> ::cend() const //had to make a promise to compiler
     {
         return const_iterator(data + numElements);
     }
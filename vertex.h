@@ -15,8 +15,46 @@
 #include <string>
 #include <cctype>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <string_view>
 using std::string;
 
+// a buffer this long holds the text of any of the verticies below
+#define VERTEX_TEXT_MAX 16
+
+/********************************************************
+ * VERTEX DOMAIN
+ * The bounds of the verticies of one graph: how many
+ * there are and, for a grid, how many columns it has.
+ * Every vertex carries its own copy so that graphs of
+ * different sizes can live side by side
+ *******************************************************/
+class VertexDomain
+{
+public:
+   explicit VertexDomain(int max = 10, int maxCol = 0) :
+      max(max), maxCol(maxCol) { assert(max > 0 && maxCol >= 0); }
+
+   // the total number of verticies
+   int getMax() const   { return max;                       }
+   void setMax(int max) { assert(max > 0); this->max = max; }
+
+   // the shape of a grid
+   int getMaxCol() const { return maxCol;                     }
+   int getMaxRow() const { return getMax() / getMaxCol();     }
+   void setMax(int col, int row)
+   {
+      assert(col > 0 && row > 0 && col < 26 && row < 100);
+      maxCol = col;
+      max    = col * row;
+   }
+
+private:
+   int max;
+   int maxCol;
+};
+
 /********************************************************
  * VERTEX
  * A generic Vertex class serving as a base class
@@ -27,14 +65,20 @@ public:
    // constructors (With validation)
    Vertex() : i(-1)          {             }
    Vertex(int index) : i(-1) { set(index); }
-   Vertex(const Vertex & v) { i = v.i;    }
+   Vertex(int index, const VertexDomain & domain) : i(-1), domain(domain)
+                             { set(index); }
+   Vertex(const Vertex & v) : i(v.i), domain(v.domain) {}
  
    // set (the validation part)
    void set(int index) { if (index >= 0 && index < getMax()) this->i = index; }
 
    // handle max
-   int getMax() const   { return max;                       }
-   void setMax(int max) { assert(max > 0); this->max = max; }            
+   int getMax() const   { return domain.getMax(); }
+   void setMax(int max) { domain.setMax(max);     }
+
+   // the bounds this vertex is validated against
+   const VertexDomain & getDomain() const       { return domain;          }
+   void setDomain(const VertexDomain & domain)  { this->domain = domain;  }
    
    // I/O
    friend std::ostream & operator << (std::ostream & out, const Vertex & rhs);
@@ -42,6 +86,15 @@ public:
 
    virtual string getText() const         { return string("ERROR");       }
    virtual bool setText(const string & s) { assert(false); return false;  }
+
+   // write the text into the caller's buffer instead of a new string.
+   //    Like snprintf, at most size - 1 characters and a null are written
+   //    and the full length of the text is returned
+   virtual int writeText(char * buffer, int size) const
+   {
+      string s = getText();
+      return copyText(buffer, size, s.data(), s.size());
+   }
    
    // get a scalar value
    int index() const { return i; }
@@ -54,11 +107,28 @@ public:
    bool operator == (const Vertex & rhs) const {return index() == rhs.index();}
    bool operator != (const Vertex & rhs) const {return index() != rhs.index();}
 
-   Vertex & operator = (const Vertex & rhs) { i = rhs.i; return *this; }
+   Vertex & operator = (const Vertex & rhs)
+   {
+      i = rhs.i;
+      domain = rhs.domain;
+      return *this;
+   }
    
 protected:
    int i;
-   static int max;
+   VertexDomain domain;
+
+   // the truncating copy behind writeText()
+   static int copyText(char * buffer, int size, const char * text, int length)
+   {
+      if (size > 0)
+      {
+         int numCopy = (length < size ? length : size - 1);
+         std::memcpy(buffer, text, numCopy);
+         buffer[numCopy] = '\0';
+      }
+      return length;
+   }
 };
 
 /**************************************************
@@ -67,7 +137,13 @@ protected:
  **************************************************/
 inline std::ostream & operator << (std::ostream & out, const Vertex & rhs)
 {
-   out << rhs.getText();
+   // the text is formatted on the stack unless it is too long for that
+   char buffer[VERTEX_TEXT_MAX];
+   int length = rhs.writeText(buffer, sizeof(buffer));
+   if (length < (int)sizeof(buffer))
+      out.write(buffer, length);
+   else
+      out << rhs.getText();
    return out;
 }
 
@@ -106,6 +182,8 @@ public:
       i = 0;
       setText(letter);
    }
+
+   LVertex(const Vertex & v) : Vertex(v) { }
       
    // return the text version of the index: 0 --> A
    string getText() const
@@ -115,6 +193,12 @@ public:
       return s;
    }
 
+   int writeText(char * buffer, int size) const
+   {
+      char letter = (char)(i + 'A');
+      return copyText(buffer, size, &letter, 1);
+   }
+
    // sent an index based on a single letter
    bool setText(char letter)
    {
@@ -135,7 +219,100 @@ public:
    }
 };
 
-#define NUM_CLASS 28
+/********************************************************
+ * LABEL HASH
+ * FNV-1a hash of the text of a vertex. The seed changes
+ * the hash completely, so a seed that scatters a fixed
+ * set of labels without any collision can be searched for
+ *******************************************************/
+constexpr unsigned int labelHash(const char * s, std::size_t length,
+                                 unsigned int seed)
+{
+   unsigned int h = 2166136261u ^ (seed * 16777619u);
+   for (std::size_t i = 0; i < length; i++)
+   {
+      h ^= (unsigned char)s[i];
+      h *= 16777619u;
+   }
+   // the low bits are used as the slot, so fold the high ones in
+   return h ^ (h >> 15);
+}
+
+#define NUM_CLASS       28
+#define NUM_CLASS_SLOTS 64   // a power of two: one cache line of slots
+
+// all the classes in the sequence
+constexpr const char * COURSE_NAMES[NUM_CLASS] =
+{
+   "CS124",   "CS165",
+
+   "CS213",   "CS235",   "CS237",
+   "CS238",   "CS246",
+
+   "CS306",   "CS308",   "CS312",
+   "CS313",   "CS345",   "CS361",
+   "CS364",   "CS371",   "CS398",
+
+   "CS416",   "CS432",   "CS450",
+   "CS460",   "CS470",   "CS480",
+   "CS499",
+
+   "CIT225",
+
+   "ECEN160",
+   "ECEN260",
+   "ECEN324", "ECEN361"
+};
+
+/********************************************************
+ * COURSE TABLE
+ * A perfect hash of the course names, generated by the
+ * compiler: the first seed that sends every course to its
+ * own slot. Every other slot holds -1
+ *******************************************************/
+struct CourseTable
+{
+   unsigned int seed;
+   signed char slots[NUM_CLASS_SLOTS];
+};
+
+constexpr std::size_t labelLength(const char * s)
+{
+   std::size_t length = 0;
+   while (s[length])
+      length++;
+   return length;
+}
+
+constexpr CourseTable buildCourseTable()
+{
+   for (unsigned int seed = 1; seed < 100000; seed++)
+   {
+      CourseTable table = {};
+      table.seed = seed;
+      for (int slot = 0; slot < NUM_CLASS_SLOTS; slot++)
+         table.slots[slot] = -1;
+
+      bool collision = false;
+      for (int i = 0; i < NUM_CLASS && !collision; i++)
+      {
+         unsigned int slot = labelHash(COURSE_NAMES[i],
+                                       labelLength(COURSE_NAMES[i]), seed)
+                             & (NUM_CLASS_SLOTS - 1);
+         if (table.slots[slot] != -1)
+            collision = true;
+         else
+            table.slots[slot] = (signed char)i;
+      }
+
+      if (!collision)
+         return table;
+   }
+   return CourseTable {};
+}
+
+inline constexpr CourseTable COURSE_TABLE = buildCourseTable();
+static_assert(COURSE_TABLE.seed != 0, "no perfect hash for the course names");
 
 /****************************************************
  * COURSE  VERTEX  
@@ -144,53 +321,47 @@ public:
 class CourseVertex : public Vertex
 {
 public:
-   CourseVertex()        : Vertex() { max = NUM_CLASS;                }
-   CourseVertex(const Vertex & v)   { max = NUM_CLASS; i = v.index(); }
-   CourseVertex(int num) : Vertex() { set(num);                       }
+   CourseVertex()        : Vertex() { setMax(NUM_CLASS);                }
+   CourseVertex(const Vertex & v)   { setMax(NUM_CLASS); i = v.index(); }
+   CourseVertex(int num) : Vertex() { setMax(NUM_CLASS); set(num);      }
    
    // return the text version of the index: 0 --> CS124
-   string getText() const          { return nameFromIndex(i);        }
+   string getText() const          { return string(nameFromIndex(i)); }
+
+   int writeText(char * buffer, int size) const
+   {
+      std::string_view name = nameFromIndex(i);
+      return copyText(buffer, size, name.data(), name.size());
+   }
 
    // set an index based on the text:  CS124 --> 0
    bool setText(const string & s)
    {
-      for (int i = 0; i < NUM_CLASS; i++)
-         if (s == nameFromIndex(i))
-         {
-            this->i = i;
-            return true;
-         }
-      return false;
+      int index = indexFromName(s);
+      if (index < 0)
+         return false;
+      this->i = index;
+      return true;
    }
-private:
-   // because this is a bit non-trivial, we need a separate function for this
-   string & nameFromIndex(int i) const
+
+   // the course at the one slot the name can hash to, or -1
+   static int indexFromName(std::string_view s)
+   {
+      unsigned int slot = labelHash(s.data(), s.size(), COURSE_TABLE.seed)
+                          & (NUM_CLASS_SLOTS - 1);
+      int index = COURSE_TABLE.slots[slot];
+
+      // any text can land on a slot, so it still has to match
+      if (index < 0 || nameFromIndex(index) != s)
+         return -1;
+      return index;
+   }
+
+   // the name of a course, pointing into the static table: 0 --> CS124
+   static constexpr std::string_view nameFromIndex(int i)
    {
-      // all the classes in the sequence
-      static string classes[] =
-         {
-            string("CS124"),   string("CS165"),
-      
-            string("CS213"),   string("CS235"),   string("CS237"),
-            string("CS238"),   string("CS246"),
-
-            string("CS306"),   string("CS308"),   string("CS312"), 
-            string("CS313"),   string("CS345"),   string("CS361"),
-            string("CS364"),   string("CS371"),   string("CS398"),
-
-            string("CS416"),    string("CS432"),  string("CS450"),
-            string("CS460"),    string("CS470"),  string("CS480"),
-            string("CS499"),
-
-            string("CIT225"),
-            
-            string("ECEN160"),
-            string("ECEN260"),
-            string("ECEN324"), string("ECEN361")
-         };
       assert(i >= 0 && i < NUM_CLASS);
-      assert(sizeof(classes) / sizeof(classes[0]) == NUM_CLASS);
-      return classes[i];
+      return std::string_view(COURSE_NAMES[i]);
    }
 };
 
@@ -202,9 +373,11 @@ class CVertex : public Vertex
 {
 public:
    CVertex()                    : Vertex() {                }
-   CVertex(int col, int row)    : Vertex() { set(col, row); }
-   CVertex(const CVertex & rhs) : Vertex() { i = rhs.i;     }
-   CVertex(const  Vertex & rhs) : Vertex() { i = rhs.index();     }
+   CVertex(const VertexDomain & domain) : Vertex(-1, domain) {  }
+   CVertex(int col, int row, const VertexDomain & domain) :
+                                  Vertex(-1, domain) { set(col, row); }
+   CVertex(const CVertex & rhs) : Vertex(rhs) {             }
+   CVertex(const  Vertex & rhs) : Vertex(rhs) {             }
 
    // set a given vertex
    bool set(int col, int row)
@@ -223,20 +396,28 @@ public:
    // return the text version of the index: (1,3) --> b4
    string getText() const
    {
-      string s;
+      char buffer[VERTEX_TEXT_MAX];
+      int length = writeText(buffer, sizeof(buffer));
+      return string(buffer, length);
+   }
+
+   int writeText(char * buffer, int size) const
+   {
+      char s[3];
+      int length = 0;
       // column is letter a .. z (or whatever)
       // row is number 1 ... 100 (or whatever)
-      s += (char)(getCol() + 'a');
+      s[length++] = (char)(getCol() + 'a');
       if (getRow() < 9)
-         s += (char)(getRow() + '1');
+         s[length++] = (char)(getRow() + '1');
       else
       {
          assert((getRow() + 1) / 10 >= 0 && (getRow() + 1) / 10 <= 9);
          assert((getRow() + 1) % 10 >= 0 && (getRow() + 1) % 10 <= 9);         
-         s += (char)((getRow() + 1) / 10 + '0');
-         s += (char)((getRow() + 1) % 10 + '0');
+         s[length++] = (char)((getRow() + 1) / 10 + '0');
+         s[length++] = (char)((getRow() + 1) % 10 + '0');
       }
-      return s;
+      return copyText(buffer, size, s, length);
    }
    
    // set an index based on the text: b4 --> (1,3)
@@ -252,19 +433,11 @@ public:
    // get the column and row from the current index
    int getRow()    const { return i / getMaxCol();        }
    int getCol()    const { return i % getMaxCol();        }
-   int getMaxCol() const { return maxCol;                 }
-   int getMaxRow() const { return getMax() / getMaxCol(); }
+   int getMaxCol() const { return domain.getMaxCol();     }
+   int getMaxRow() const { return domain.getMaxRow();     }
 
    // set the max row
-   void setMax(int col, int row)
-   {
-      assert(col > 0 && row > 0 && col < 26 && row < 100);
-      maxCol = col;
-      max    = col * row;
-   }
-
-private:
-   static int maxCol;
+   void setMax(int col, int row) { domain.setMax(col, row); }
 };
 
 